@@ -186,6 +186,7 @@
 #cmakedefine HAVE_MPROTECT 1
 #cmakedefine HAVE_PERROR 1
 #cmakedefine HAVE_POLL 1
+#cmakedefine HAVE_POSIX_FADVISE 1
 #cmakedefine HAVE_POSIX_FALLOCATE 1
 #cmakedefine HAVE_FALLOC_PUNCH_HOLE_AND_KEEP_SIZE 1
 #cmakedefine HAVE_PREAD 1
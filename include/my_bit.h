@@ -93,15 +93,24 @@ Count bits in 32bit integer
 */
 static inline uint my_count_bits_uint32(uint32 v)
 {
+#if defined __GNUC__ && (defined __POPCNT__ || defined __aarch64__)
+  /* The target has an instruction for this */
+  return (uint) __builtin_popcount(v);
+#else
   v = v - ((v >> 1) & 0x55555555);
   v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
   return (((v + (v >> 4)) & 0xF0F0F0F) * 0x1010101) >> 24;
+#endif
 }
 
 
 static inline uint my_count_bits(ulonglong x)
 {
+#if defined __GNUC__ && (defined __POPCNT__ || defined __aarch64__)
+  return (uint) __builtin_popcountll(x);
+#else
   return my_count_bits_uint32((uint32)x) + my_count_bits_uint32((uint32)(x >> 32));
+#endif
 }
 
 
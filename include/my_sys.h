@@ -480,6 +480,11 @@ typedef struct st_io_cache		/* Used when caching files */
   /* read_length is the same as buffer_length except when we use async io */
   size_t  read_length;
   myf	myflags;			/* Flags used to my_read/my_write */
+  /*
+    Set for a READ_CACHE if the operating system should be asked to read
+    the next block in the background while the current one is consumed.
+  */
+  my_bool read_ahead;
   /*
     alloced_buffer is set to the size of the buffer allocated for the IO_CACHE.
     Includes the overhead(storing key to ecnrypt and decrypt) for encryption.
@@ -85,43 +85,38 @@ int
 my_base64_encode(const void *src, size_t src_len, char *dst)
 {
   const unsigned char *s= (const unsigned char*)src;
-  size_t i= 0;
+  const unsigned char *end= s + src_len;
   size_t len= 0;
+  unsigned c;
 
-  for (; i < src_len; len += 4)
+  /* Full groups of three bytes */
+  for (; end - s >= 3; s+= 3, len+= 4)
   {
-    unsigned c;
-
     if (len == 76)
     {
       len= 0;
       *dst++= '\n';
     }
+    c= ((unsigned) s[0] << 16) | ((unsigned) s[1] << 8) | s[2];
+    dst[0]= base64_table[(c >> 18) & 0x3f];
+    dst[1]= base64_table[(c >> 12) & 0x3f];
+    dst[2]= base64_table[(c >> 6) & 0x3f];
+    dst[3]= base64_table[c & 0x3f];
+    dst+= 4;
+  }
 
-    c= s[i++];
-    c <<= 8;
-
-    if (i < src_len)
-      c += s[i];
-    c <<= 8;
-    i++;
-
-    if (i < src_len)
-      c += s[i];
-    i++;
-
+  /* The last one or two bytes, padded with '=' */
+  if (s < end)
+  {
+    if (len == 76)
+      *dst++= '\n';
+    c= (unsigned) s[0] << 16;
+    if (s + 1 < end)
+      c|= (unsigned) s[1] << 8;
     *dst++= base64_table[(c >> 18) & 0x3f];
     *dst++= base64_table[(c >> 12) & 0x3f];
-
-    if (i > (src_len + 1))
-      *dst++= '=';
-    else
-      *dst++= base64_table[(c >> 6) & 0x3f];
-
-    if (i > src_len)
-      *dst++= '=';
-    else
-      *dst++= base64_table[(c >> 0) & 0x3f];
+    *dst++= s + 1 < end ? base64_table[(c >> 6) & 0x3f] : '=';
+    *dst++= '=';
   }
   *dst= '\0';
 
@@ -325,6 +320,28 @@ my_base64_decode(const char *src_base, size_t len,
 
   for ( ; ; )
   {
+    /*
+      Decode groups of four base64 characters without spaces or padding
+      directly. Everything else is handled character by character below.
+    */
+    while (decoder.end - decoder.src >= 4)
+    {
+      const uchar *s= (const uchar *) decoder.src;
+      int c0= from_base64_table[s[0]];
+      int c1= from_base64_table[s[1]];
+      int c2= from_base64_table[s[2]];
+      int c3= from_base64_table[s[3]];
+      uint c;
+      if ((c0 | c1 | c2 | c3) < 0)
+        break;
+      c= ((uint) c0 << 18) | ((uint) c1 << 12) | ((uint) c2 << 6) | (uint) c3;
+      d[0]= (char) (c >> 16);
+      d[1]= (char) (c >> 8);
+      d[2]= (char) c;
+      d+= 3;
+      decoder.src+= 4;
+    }
+
     decoder.c= 0;
     decoder.state= 0;
 
@@ -264,6 +264,7 @@ int init_io_cache_ext(IO_CACHE *info, File file, size_t cachesize,
   DBUG_PRINT("info",("init_io_cache_ext: cachesize = %lu", (ulong) cachesize));
   info->read_length=info->buffer_length=cachesize;
   info->myflags=cache_myflags & ~(MY_NABP | MY_FNABP);
+  info->read_ahead= use_async_io && type == READ_CACHE;
   info->request_pos= info->read_pos= info->write_pos = info->buffer;
   if (type == SEQ_READ_APPEND)
   {
@@ -415,8 +416,7 @@ void seek_io_cache(IO_CACHE *cache, my_off_t needed_offset)
 */
 
 my_bool reinit_io_cache(IO_CACHE *info, enum cache_type type,
-			my_off_t seek_offset,
-			my_bool use_async_io __attribute__((unused)),
+			my_off_t seek_offset, my_bool use_async_io,
 			my_bool clear_cache)
 {
   DBUG_ENTER("reinit_io_cache");
@@ -511,6 +511,7 @@ my_bool reinit_io_cache(IO_CACHE *info, enum cache_type type,
   }
   info->type=type;
   info->error=0;
+  info->read_ahead= use_async_io && type == READ_CACHE;
   init_functions(info);
   DBUG_RETURN(0);
 } /* reinit_io_cache */
@@ -760,6 +761,17 @@ int _my_b_cache_read(IO_CACHE *info, uchar *Buffer, size_t Count)
       info->seek_not_done=1;
       DBUG_RETURN(1);
     }
+#ifdef HAVE_POSIX_FADVISE
+    /*
+      Let the operating system fetch the next block while the caller
+      consumes this one, so that the next refill does not have to wait
+      for the disk.
+    */
+    if (info->read_ahead && length == max_length &&
+        pos_in_file + length < info->end_of_file)
+      (void) posix_fadvise(info->file, pos_in_file + length,
+                           info->read_length, POSIX_FADV_WILLNEED);
+#endif
   }
   /*
     Count is the remaining number of bytes requested.
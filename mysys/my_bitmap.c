@@ -38,6 +38,37 @@
 #include <m_string.h>
 #include <my_bit.h>
 
+#if defined __GNUC__ && !defined __POPCNT__ && \
+  (defined __x86_64__ || defined __i386__)
+/*
+  The compiler may not use the POPCNT instruction for my_count_bits_uint32()
+  as it is not available on all x86 CPUs: check for it at runtime.
+*/
+#include <cpuid.h>
+#define POPCNT_AT_RUNTIME
+
+__attribute__((target("popcnt")))
+static uint bits_set_popcnt(const my_bitmap_map *data_ptr,
+                            const my_bitmap_map *end)
+{
+  uint res= 0;
+  for (; data_ptr < end; data_ptr++)
+    res+= (uint) __builtin_popcount(*data_ptr);
+  return res;
+}
+
+static my_bool have_popcnt(void)
+{
+  static int8 popcnt= -1;
+  if (unlikely(popcnt < 0))
+  {
+    uint eax, ebx, ecx, edx;
+    popcnt= __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_POPCNT);
+  }
+  return popcnt;
+}
+#endif
+
 /*
   Create a mask with the upper 'unused' bits set and the lower 'used'
   bits clear. The bits within each byte is stored in big-endian order.
@@ -565,6 +596,11 @@ uint bitmap_bits_set(const MY_BITMAP *map)
   uint res= 0;
   DBUG_ASSERT(map->bitmap);
 
+#ifdef POPCNT_AT_RUNTIME
+  if (have_popcnt())
+    res= bits_set_popcnt(data_ptr, end);
+  else
+#endif
   for (; data_ptr < end; data_ptr++)
     res+= my_count_bits_uint32(*data_ptr);
 
@@ -223,6 +223,65 @@ static uint skip_digits(const char **str, const char *end)
 }
 
 
+/**
+  Parse a string in the canonical 'YYYY-MM-DD' or 'YYYY-MM-DD hh:mm:ss'
+  layout, in which all field positions are known in advance.
+
+  This is a shortcut for str_to_datetime_or_date_body(). The result is the
+  same as the generic field-by-field parsing would produce.
+
+  @param l_time            the result
+  @param number_of_fields  set to the number of parsed fields
+  @param str               the string; on success, advanced past the
+                           parsed fields
+  @param end               end of the string
+  @retval TRUE   str was parsed
+  @retval FALSE  str does not start with a canonical date or datetime,
+                 nothing was changed
+*/
+static my_bool get_canonical_datetime(MYSQL_TIME *l_time,
+                                      uint *number_of_fields,
+                                      const char **str, const char *end)
+{
+  /* Positions of the digits in 'YYYY-MM-DD hh:mm:ss' */
+  static const uchar digit_pos[14]= {0,1,2,3, 5,6, 8,9, 11,12, 14,15, 17,18};
+  const uchar *s= (const uchar *) *str;
+  size_t length= (size_t) (end - *str);
+  uint d[14], n, i;
+
+  if (length < 10 || s[4] != '-' || s[7] != '-')
+    return FALSE;
+  if (length == 10)
+    n= 8;
+  else if (length >= 19 && (s[10] == ' ' || s[10] == 'T') &&
+           s[13] == ':' && s[16] == ':' &&
+           (length == 19 || !my_isdigit(&my_charset_latin1, s[19])))
+    n= 14;
+  else
+    return FALSE;
+
+  for (i= 0; i < n; i++)
+    if ((d[i]= (uint) s[digit_pos[i]] - '0') > 9)
+      return FALSE;
+
+  l_time->year= ((d[0] * 10 + d[1]) * 10 + d[2]) * 10 + d[3];
+  l_time->month= d[4] * 10 + d[5];
+  l_time->day= d[6] * 10 + d[7];
+  if (n == 8)
+  {
+    *number_of_fields= 3;
+    *str+= 10;
+    return TRUE;
+  }
+  l_time->hour= d[8] * 10 + d[9];
+  l_time->minute= d[10] * 10 + d[11];
+  l_time->second= d[12] * 10 + d[13];
+  *number_of_fields= 6;
+  *str+= 19;
+  return TRUE;
+}
+
+
 /**
   Check datetime, date, or normalized time (i.e. time without days) range.
   @param ltime   Datetime value.
@@ -520,61 +579,66 @@ str_to_datetime_or_date_body(const char *str, size_t length, MYSQL_TIME *l_time,
   *number_of_fields= 0;
   *endptr= str;
 
-  /*
-    Calculate number of digits in first part.
-    If length= 8 or >= 14 then year is of format YYYY.
-    (YYYY-MM-DD,  YYYYMMDD, YYYYYMMDDHHMMSS)
-  */
-  pos= str;
-  digits= skip_digits(&pos, end);
-
-  if (pos < end && *pos == 'T') /* YYYYYMMDDHHMMSSThhmmss is supported too */
-  {
-    pos++;
-    digits+= skip_digits(&pos, end);
-  }
-  if (pos < end && *pos == '.' && digits >= 12) /* YYYYYMMDDHHMMSShhmmss.uuuuuu is supported too */
-  {
-    pos++;
-    skip_digits(&pos, end); // ignore the return value
-  }
-
-  if (pos == end)
+  if (get_canonical_datetime(l_time, number_of_fields, &str, end))
+    year_length= 4;
+  else
   {
     /*
-      Found date in internal format
-      (only numbers like [YY]YYMMDD[T][hhmmss[.uuuuuu]])
+      Calculate number of digits in first part.
+      If length= 8 or >= 14 then year is of format YYYY.
+      (YYYY-MM-DD,  YYYYMMDD, YYYYYMMDDHHMMSS)
     */
-    year_length= (digits == 4 || digits == 8 || digits >= 14) ? 4 : 2;
-    if (get_digits(&l_time->year, number_of_fields, &str, end, year_length) 
-        || get_digits(&l_time->month, number_of_fields, &str, end, 2)
-        || get_digits(&l_time->day, number_of_fields, &str, end, 2)
-        || get_maybe_T(&str, end)
-        || get_digits(&l_time->hour, number_of_fields, &str, end, 2)
-        || get_digits(&l_time->minute, number_of_fields, &str, end, 2)
-        || get_digits(&l_time->second, number_of_fields, &str, end, 2))
-     warn|= MYSQL_TIME_WARN_TRUNCATED;
-  }
-  else
-  {
-    const char *start= str;
-    if (get_number(&l_time->year, number_of_fields, &str, end))
-      warn|= MYSQL_TIME_WARN_TRUNCATED;
-    year_length= (uint)(str - start);
-
-    if (!warn &&
-        (get_punct(&str, end)
-         || get_number(&l_time->month, number_of_fields, &str, end)
-         || get_punct(&str, end)
-         || get_number(&l_time->day, number_of_fields, &str, end)
-         || get_date_time_separator(number_of_fields,
-                                    punct_is_date_time_separator, &str, end)
-         || get_number(&l_time->hour, number_of_fields, &str, end)
-         || get_punct(&str, end)
-         || get_number(&l_time->minute, number_of_fields, &str, end)
-         || get_punct(&str, end)
-         || get_number(&l_time->second, number_of_fields, &str, end)))
-      warn|= MYSQL_TIME_WARN_TRUNCATED;
+    pos= str;
+    digits= skip_digits(&pos, end);
+
+    if (pos < end && *pos == 'T') /* YYYYYMMDDHHMMSSThhmmss is supported too */
+    {
+      pos++;
+      digits+= skip_digits(&pos, end);
+    }
+    if (pos < end && *pos == '.' && digits >= 12) /* YYYYYMMDDHHMMSShhmmss.uuuuuu is supported too */
+    {
+      pos++;
+      skip_digits(&pos, end); // ignore the return value
+    }
+
+    if (pos == end)
+    {
+      /*
+        Found date in internal format
+        (only numbers like [YY]YYMMDD[T][hhmmss[.uuuuuu]])
+      */
+      year_length= (digits == 4 || digits == 8 || digits >= 14) ? 4 : 2;
+      if (get_digits(&l_time->year, number_of_fields, &str, end, year_length) 
+          || get_digits(&l_time->month, number_of_fields, &str, end, 2)
+          || get_digits(&l_time->day, number_of_fields, &str, end, 2)
+          || get_maybe_T(&str, end)
+          || get_digits(&l_time->hour, number_of_fields, &str, end, 2)
+          || get_digits(&l_time->minute, number_of_fields, &str, end, 2)
+          || get_digits(&l_time->second, number_of_fields, &str, end, 2))
+       warn|= MYSQL_TIME_WARN_TRUNCATED;
+    }
+    else
+    {
+      const char *start= str;
+      if (get_number(&l_time->year, number_of_fields, &str, end))
+        warn|= MYSQL_TIME_WARN_TRUNCATED;
+      year_length= (uint)(str - start);
+
+      if (!warn &&
+          (get_punct(&str, end)
+           || get_number(&l_time->month, number_of_fields, &str, end)
+           || get_punct(&str, end)
+           || get_number(&l_time->day, number_of_fields, &str, end)
+           || get_date_time_separator(number_of_fields,
+                                      punct_is_date_time_separator, &str, end)
+           || get_number(&l_time->hour, number_of_fields, &str, end)
+           || get_punct(&str, end)
+           || get_number(&l_time->minute, number_of_fields, &str, end)
+           || get_punct(&str, end)
+           || get_number(&l_time->second, number_of_fields, &str, end)))
+        warn|= MYSQL_TIME_WARN_TRUNCATED;
+    }
   }
   status->warnings|= warn;
 
@@ -5852,6 +5852,8 @@ class Copy_field :public Sql_alloc {
   ~Copy_field() {}
   void set(Field *to,Field *from,bool save);	// Field to field 
   void set(uchar *to,Field *from);		// Field to string
+  bool is_memcpy() const;
+  bool merge(const Copy_field &next);		// Join adjacent memcpy()
   void (*do_copy)(Copy_field *);
   void (*do_copy2)(Copy_field *);		// Used to handle null values
 };
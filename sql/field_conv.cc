@@ -724,6 +724,52 @@ void Copy_field::set(Field *to,Field *from,bool save)
 }
 
 
+/**
+  Check if a copy is a plain memcpy() of a NOT NULL field.
+*/
+
+bool Copy_field::is_memcpy() const
+{
+  if (do_copy == do_skip || from_null_ptr || to_null_ptr ||
+      do_copy != do_copy2 || from_length != to_length)
+    return false;
+  if (do_copy == Field::do_field_eq)
+    return true;
+  switch (from_length) {
+  case 1: return do_copy == do_field_1;
+  case 2: return do_copy == do_field_2;
+  case 3: return do_copy == do_field_3;
+  case 4: return do_copy == do_field_4;
+  case 6: return do_copy == do_field_6;
+  case 8: return do_copy == do_field_8;
+  }
+  return false;
+}
+
+
+/**
+  Extend this copy to also cover the next one.
+
+  Possible when both are plain memcpy() copies and the next field follows
+  this one directly both in the source and in the destination record,
+  which is the common case for the unchanged columns of ALTER TABLE.
+
+  @return whether next was merged into this copy
+*/
+
+bool Copy_field::merge(const Copy_field &next)
+{
+  if (!is_memcpy() || !next.is_memcpy() ||
+      from_ptr + from_length != next.from_ptr ||
+      to_ptr + to_length != next.to_ptr)
+    return false;
+  from_length+= next.from_length;
+  to_length= from_length;
+  do_copy= do_copy2= Field::do_field_eq;
+  return true;
+}
+
+
 Field::Copy_func *Field_timestamp::get_copy_func(const Field *from) const
 {
   Field::Copy_func *copy= Field_temporal::get_copy_func(from);
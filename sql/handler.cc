@@ -6779,6 +6779,171 @@ check_result_t handler_rowid_filter_check(void *h_arg)
 }
 
 
+/**
+  Check if an engine can evaluate a condition on its own records
+
+  @return whether cond consists of comparisons, IN, BETWEEN and IS NULL
+  predicates between stored non-BLOB columns of table and constants of
+  the same comparison type
+*/
+
+static bool is_simple_engine_cond(const Item *cond, const TABLE *table)
+{
+  if (cond->type() == Item::COND_ITEM)
+  {
+    Item_cond *item_cond= (Item_cond*) cond;
+    if (item_cond->functype() != Item_func::COND_AND_FUNC &&
+        item_cond->functype() != Item_func::COND_OR_FUNC)
+      return false;
+    List_iterator_fast<Item> li(*item_cond->argument_list());
+    while (Item *item= li++)
+    {
+      if (!is_simple_engine_cond(item, table))
+        return false;
+    }
+    return true;
+  }
+
+  if (cond->type() != Item::FUNC_ITEM)
+    return false;
+
+  const Item_func *func= (const Item_func*) cond;
+  switch (func->functype()) {
+  case Item_func::EQ_FUNC:
+  case Item_func::EQUAL_FUNC:
+  case Item_func::NE_FUNC:
+  case Item_func::LT_FUNC:
+  case Item_func::LE_FUNC:
+  case Item_func::GE_FUNC:
+  case Item_func::GT_FUNC:
+  case Item_func::BETWEEN:
+  case Item_func::IN_FUNC:
+  case Item_func::ISNULL_FUNC:
+  case Item_func::ISNOTNULL_FUNC:
+    break;
+  default:
+    return false;
+  }
+  if (!func->argument_count())
+    return false;
+
+  /*
+    Comparisons that convert their arguments could report the same
+    warning once in the engine and once more in the SQL layer.
+  */
+  Item_result cmp_type= func->arguments()[0]->cmp_type();
+  for (uint i= 0; i < func->argument_count(); i++)
+  {
+    Item *arg= func->arguments()[i];
+    if (arg->cmp_type() != cmp_type)
+      return false;
+    if (arg->type() == Item::FIELD_ITEM)
+    {
+      Field *field= ((Item_field*) arg)->field;
+      if (field->table != table || !field->stored_in_db() ||
+          (field->flags & BLOB_FLAG))
+        return false;
+    }
+    else if (!arg->basic_const_item())
+      return false;
+  }
+  return true;
+}
+
+
+static void mark_engine_cond_fields(const Item *cond, MY_BITMAP *fields)
+{
+  if (cond->type() == Item::FIELD_ITEM)
+    bitmap_set_bit(fields, ((Item_field*) cond)->field->field_index);
+  else if (cond->type() == Item::COND_ITEM)
+  {
+    List_iterator_fast<Item> li(*((Item_cond*) cond)->argument_list());
+    while (Item *item= li++)
+      mark_engine_cond_fields(item, fields);
+  }
+  else if (cond->type() == Item::FUNC_ITEM)
+  {
+    const Item_func *func= (const Item_func*) cond;
+    for (uint i= 0; i < func->argument_count(); i++)
+      mark_engine_cond_fields(func->arguments()[i], fields);
+  }
+}
+
+
+/**
+  Extract the part of a pushed table condition that an engine can check
+  with handler_table_cond_check() while reading its records
+
+  @param      thd     thread handle
+  @param      cond    condition passed to handler::cond_push()
+  @param      table   table being read
+  @param[out] fields  columns that the returned condition refers to;
+                      allocated on thd->mem_root
+
+  @return the conjuncts of cond that compare columns of table with
+  constants, or NULL if there are none
+*/
+
+Item *make_engine_table_cond(THD *thd, const COND *cond, TABLE *table,
+                             MY_BITMAP *fields)
+{
+  Item *item= (Item*) cond;
+  Item *res= NULL;
+
+  if (is_simple_engine_cond(item, table))
+    res= item;
+  else if (item->type() == Item::COND_ITEM &&
+           ((Item_cond*) item)->functype() == Item_func::COND_AND_FUNC)
+  {
+    List<Item> simple;
+    List_iterator_fast<Item> li(*((Item_cond*) item)->argument_list());
+    while (Item *arg= li++)
+    {
+      if (is_simple_engine_cond(arg, table) &&
+          simple.push_back(arg, thd->mem_root))
+        return NULL;
+    }
+    if (simple.elements == 1)
+      res= simple.head();
+    else if (simple.elements)
+    {
+      if (!(res= new (thd->mem_root) Item_cond_and(thd, simple)))
+        return NULL;
+      res->quick_fix_field();
+    }
+  }
+
+  if (!res)
+    return NULL;
+
+  my_bitmap_map *buf= (my_bitmap_map*)
+    thd->alloc(bitmap_buffer_size(table->s->fields));
+  if (!buf || my_bitmap_init(fields, buf, table->s->fields))
+    return NULL;
+  mark_engine_cond_fields(res, fields);
+  return res;
+}
+
+
+/**
+  Table condition callback - to be called by an engine to check the
+  condition returned by make_engine_table_cond() on table->record[0]
+*/
+
+check_result_t handler_table_cond_check(handler *h, Item *cond)
+{
+  THD *thd= h->get_table()->in_use;
+  enum thd_kill_levels abort_at= h->has_rollback() ?
+    THD_ABORT_SOFTLY : THD_ABORT_ASAP;
+  if (thd_kill_level(thd) > abort_at)
+    return CHECK_ABORTED_BY_USER;
+
+  if (h->end_range && h->compare_key2(h->end_range) > 0)
+    return CHECK_OUT_OF_RANGE;
+  return cond->val_int() ? CHECK_POS : CHECK_NEG;
+}
+
+
 /**
   Callback function for an engine to check whether the used rowid filter
   has been already built
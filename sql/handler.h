@@ -3031,6 +3031,10 @@ extern "C" check_result_t handler_index_cond_check(void* h_arg);
 extern "C" check_result_t handler_rowid_filter_check(void* h_arg);
 extern "C" int handler_rowid_filter_is_active(void* h_arg);
 
+Item *make_engine_table_cond(THD *thd, const COND *cond, TABLE *table,
+                             MY_BITMAP *fields);
+check_result_t handler_table_cond_check(handler *h, Item *cond);
+
 uint calculate_key_len(TABLE *, uint, const uchar *, key_part_map);
 /*
   bitmap with first N+1 bits set
@@ -5366,13 +5370,14 @@ int binlog_log_row(TABLE* table,
 #define TABLE_IO_WAIT(TRACKER, OP, INDEX, RESULT, PAYLOAD) \
   { \
     Exec_time_tracker *this_tracker; \
+    bool this_tracker_timed= false; \
     if (unlikely((this_tracker= tracker))) \
-      tracker->start_tracking(table->in_use); \
+      this_tracker_timed= tracker->start_sampled_tracking(table->in_use); \
     \
     MYSQL_TABLE_IO_WAIT(OP, INDEX, RESULT, PAYLOAD); \
     \
     if (unlikely(this_tracker)) \
-      tracker->stop_tracking(table->in_use); \
+      tracker->stop_sampled_tracking(table->in_use, this_tracker_timed); \
   }
 void print_keydup_error(TABLE *table, KEY *key, const char *msg, myf errflag);
 void print_keydup_error(TABLE *table, KEY *key, myf errflag);
@@ -4159,6 +4159,18 @@ bool Item_func_group_concat::add(bool exclude_nulls)
 {
   if (always_null && exclude_nulls)
     return 0;
+  /*
+    Without DISTINCT and ORDER BY the rows are appended to the result as
+    they come. Once the result has been cut to group_concat_max_len or
+    LIMIT rows have been appended, the remaining rows of the group cannot
+    change it, so there is no need to copy them. Functions must still be
+    evaluated for every row, because they can raise errors and warnings or
+    have side effects, like subqueries and user variable assignments.
+  */
+  if (!tree && !distinct && !null_value &&
+      !tmp_table_param->items_to_copy[0] &&
+      (warning_for_row || (limit_clause && !copy_row_limit)))
+    return 0;
   copy_fields(tmp_table_param);
   if (copy_funcs(tmp_table_param->items_to_copy, table->in_use))
     return TRUE;
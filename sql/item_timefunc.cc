@@ -2766,6 +2766,37 @@ bool Item_func_from_unixtime::get_date(THD *thd, MYSQL_TIME *ltime,
 }
 
 
+/**
+  Find the time zone named by a CONVERT_TZ() argument.
+
+  Time_zone objects are never freed, so if a non-constant argument
+  evaluates to the same name as for the previous row, the time zone found
+  then is returned without calling my_tz_find(), which acquires tz_LOCK.
+
+  @param thd        current thread
+  @param arg        time zone argument
+  @param buf        buffer for evaluating arg
+  @param last_tz    time zone found for the previous row, or NULL
+  @param last_name  name of last_tz
+  @return the time zone
+  @retval NULL if the argument is NULL or not a valid time zone
+*/
+Time_zone *Item_func_convert_tz::find_tz(THD *thd, Item *arg, String *buf,
+                                         Time_zone *last_tz,
+                                         String *last_name)
+{
+  String *name= arg->val_str_ascii(buf);
+  if (!name)
+    return NULL;
+  if (last_tz && name->length() && name->bin_eq(last_name))
+    return last_tz;
+  Time_zone *tz= my_tz_find(thd, name);
+  if (tz && !arg->const_item() && last_name->copy(*name))
+    last_name->length(0);
+  return tz;
+}
+
+
 bool Item_func_convert_tz::get_date(THD *thd, MYSQL_TIME *ltime,
                                     date_mode_t fuzzydate __attribute__((unused)))
 {
@@ -2774,13 +2805,13 @@ bool Item_func_convert_tz::get_date(THD *thd, MYSQL_TIME *ltime,
 
   if (!from_tz_cached)
   {
-    from_tz= my_tz_find(thd, args[1]->val_str_ascii(&str));
+    from_tz= find_tz(thd, args[1], &str, from_tz, &from_tz_name);
     from_tz_cached= args[1]->const_item();
   }
 
   if (!to_tz_cached)
   {
-    to_tz= my_tz_find(thd, args[2]->val_str_ascii(&str));
+    to_tz= find_tz(thd, args[2], &str, to_tz, &to_tz_name);
     to_tz_cached= args[2]->const_item();
   }
 
@@ -2810,6 +2841,9 @@ bool Item_func_convert_tz::get_date(THD *thd, MYSQL_TIME *ltime,
 void Item_func_convert_tz::cleanup()
 {
   from_tz_cached= to_tz_cached= 0;
+  from_tz= to_tz= 0;
+  from_tz_name.free();
+  to_tz_name.free();
   Item_datetimefunc::cleanup();
 }
 
@@ -1081,9 +1081,18 @@ class Item_func_convert_tz :public Item_datetimefunc
   */
   bool from_tz_cached, to_tz_cached;
   Time_zone *from_tz, *to_tz;
+  /*
+    Names of the time zones last looked up for non-constant arguments.
+    Rows having the same time zone names as the previous row reuse
+    from_tz/to_tz without looking them up again.
+  */
+  String from_tz_name, to_tz_name;
+  Time_zone *find_tz(THD *thd, Item *arg, String *buf,
+                     Time_zone *last_tz, String *last_name);
  public:
   Item_func_convert_tz(THD *thd, Item *a, Item *b, Item *c):
-    Item_datetimefunc(thd, a, b, c), from_tz_cached(0), to_tz_cached(0) {}
+    Item_datetimefunc(thd, a, b, c), from_tz_cached(0), to_tz_cached(0),
+    from_tz(0), to_tz(0) {}
   LEX_CSTRING func_name_cstring() const override
   {
     static LEX_CSTRING name= {STRING_WITH_LEN("convert_tz") };
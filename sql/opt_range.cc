@@ -2915,6 +2915,9 @@ int SQL_SELECT::test_quick_select(THD *thd, key_map keys_to_use,
         free_root(&alloc, MYF(0));
         DBUG_RETURN(-1);
       }
+      else if (param.alloced_sel_args > SEL_ARG::MAX_SEL_ARGS)
+        trace_range.add("range_scan_possible", false)
+                   .add("cause", "too many SEL_ARGs");
     }
 
     if (tree)
@@ -7988,6 +7991,15 @@ SEL_TREE *Item_func_in::get_func_mm_tree(RANGE_OPT_PARAM *param,
       {
         tree= tree_or(param, tree, get_mm_parts(param, field,
                                                 Item_func::EQ_FUNC, *arg));
+        /*
+          Once the tree can't be used for ranges, OR-ing in the remaining
+          values will not change that. Don't build the trees for them: for
+          a long IN list that is a lot of memory and time.
+        */
+        if (!tree)
+          break;
+        if (param->statement_should_be_aborted())
+          DBUG_RETURN(NULL);
       }
     }
   }
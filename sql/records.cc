@@ -239,7 +239,7 @@ bool init_read_record(READ_RECORD *info,THD *thd, TABLE *table,
     }
 
     info->io_cache= tempfile;
-    reinit_io_cache(info->io_cache,READ_CACHE,0L,0,0);
+    reinit_io_cache(info->io_cache,READ_CACHE,0L,1,0);
     info->ref_pos=table->file->ref;
     if (!table->file->inited)
       if (unlikely(table->file->ha_rnd_init_with_error(0)))
@@ -104,10 +104,11 @@ void Filesort_tracker::get_data_format(String *str)
 }
 
 void attach_gap_time_tracker(THD *thd, Gap_time_tracker *gap_tracker,
-                             ulonglong timeval)
+                             ulonglong timeval, bool sampled)
 {
   thd->gap_tracker_data.bill_to= gap_tracker;
   thd->gap_tracker_data.start_time= timeval;
+  thd->gap_tracker_data.sampled= sampled;
 }
 
 void process_gap_time_tracker(THD *thd, ulonglong timeval)
@@ -115,8 +116,20 @@ void process_gap_time_tracker(THD *thd, ulonglong timeval)
   if (thd->gap_tracker_data.bill_to)
   {
     thd->gap_tracker_data.bill_to->log_time(thd->gap_tracker_data.start_time,
-                                            timeval);
+                                            timeval,
+                                            thd->gap_tracker_data.sampled);
     thd->gap_tracker_data.bill_to= NULL;
   }
 }
 
+/*
+  End the time interval that is being billed to a Gap_time_tracker, if
+  any. Used by the calls that are not timed themselves.
+*/
+
+void end_gap_time_tracker(THD *thd)
+{
+  if (thd->gap_tracker_data.bill_to)
+    process_gap_time_tracker(thd, my_timer_cycles());
+}
+
@@ -34,13 +34,17 @@ log, should the query be slow.
 
 2. Timing data. Measuring the time it took to run parts of query has noticeable
 overhead. Because of that, we measure the time only when running "ANALYZE
-$stmt").
+$stmt"). Calls that are made for every row (the storage engine calls) are
+timed only for a sample of the calls, and the measured time is extrapolated
+to all of them.
 
 */
 
 class Gap_time_tracker;
-void attach_gap_time_tracker(THD *thd, Gap_time_tracker *gap_tracker, ulonglong timeval);
+void attach_gap_time_tracker(THD *thd, Gap_time_tracker *gap_tracker,
+                             ulonglong timeval, bool sampled= false);
 void process_gap_time_tracker(THD *thd, ulonglong timeval);
+void end_gap_time_tracker(THD *thd);
 
 /*
   A class for tracking time it takes to do a certain action
@@ -50,21 +54,34 @@ class Exec_time_tracker
 protected:
   ulonglong count;
   ulonglong cycles;
+  /*
+    Cycles of the calls that start_sampled_tracking() timed after the first
+    exact_calls. Each of them stands for sample_period calls.
+  */
+  ulonglong sampled_cycles;
   ulonglong last_start;
 
-  void cycles_stop_tracking(THD *thd)
+  void cycles_stop_tracking(THD *thd, bool sampled= false)
   {
     ulonglong end= my_timer_cycles();
-    cycles += end - last_start;
+    ulonglong &total= sampled ? sampled_cycles : cycles;
+    total += end - last_start;
     if (unlikely(end < last_start))
-      cycles += ULONGLONG_MAX;
+      total += ULONGLONG_MAX;
 
     process_gap_time_tracker(thd, end);
     if (my_gap_tracker)
-      attach_gap_time_tracker(thd, my_gap_tracker, end);
+      attach_gap_time_tracker(thd, my_gap_tracker, end, sampled);
   }
 public:
-  Exec_time_tracker() : count(0), cycles(0), my_gap_tracker(NULL) {}
+  /* The first calls are always timed by start_sampled_tracking() */
+  static const ulonglong exact_calls= 128;
+  /* After them, only every sample_period-th call is timed */
+  static const ulonglong sample_period= 16;
+
+  Exec_time_tracker() : count(0), cycles(0), sampled_cycles(0),
+    my_gap_tracker(NULL)
+  {}
 
   /*
     The time spent between stop_tracking() call on this object and any
@@ -85,16 +102,45 @@ class Exec_time_tracker
     cycles_stop_tracking(thd);
   }
 
+  /*
+    Interface for collecting time of calls that are made for every row.
+    Only a sample of the calls is timed. The time between the calls is
+    billed to my_gap_tracker only after the calls that were timed.
+
+    @return whether the call is timed and stop_sampled_tracking() must
+            be passed true
+  */
+  bool start_sampled_tracking(THD *thd)
+  {
+    if (count < exact_calls || !(count % sample_period))
+    {
+      start_tracking(thd);
+      return true;
+    }
+    end_gap_time_tracker(thd);
+    return false;
+  }
+
+  void stop_sampled_tracking(THD *thd, bool timed)
+  {
+    bool sampled= count >= exact_calls;
+    count++;
+    if (timed)
+      cycles_stop_tracking(thd, sampled);
+  }
+
   // interface for getting the time
   ulonglong get_loops() const { return count; }
   double get_time_ms() const
   {
     // convert 'cycles' to milliseconds.
-    return 1000.0 * static_cast<double>(cycles) /
+    return 1000.0 * (static_cast<double>(cycles) +
+                     static_cast<double>(sampled_cycles) * sample_period) /
       static_cast<double>(sys_timer_info.cycles.frequency);
   }
 
-  bool has_timed_statistics() const { return cycles > 0; }
+  bool has_timed_statistics() const
+  { return cycles > 0 || sampled_cycles > 0; }
 };
 
 
@@ -107,17 +153,21 @@ class Exec_time_tracker
 class Gap_time_tracker
 {
   ulonglong cycles;
+  /* Gaps after the sampled calls, see Exec_time_tracker::sampled_cycles */
+  ulonglong sampled_cycles;
 public:
-  Gap_time_tracker() : cycles(0) {}
+  Gap_time_tracker() : cycles(0), sampled_cycles(0) {}
 
-  void log_time(ulonglong start, ulonglong end) {
-    cycles += end - start;
+  void log_time(ulonglong start, ulonglong end, bool sampled) {
+    (sampled ? sampled_cycles : cycles) += end - start;
   }
 
   double get_time_ms() const
   {
     // convert 'cycles' to milliseconds.
-    return 1000.0 * static_cast<double>(cycles) /
+    return 1000.0 * (static_cast<double>(cycles) +
+                     static_cast<double>(sampled_cycles) *
+                     Exec_time_tracker::sample_period) /
       static_cast<double>(sys_timer_info.cycles.frequency);
   }
 };
@@ -860,6 +860,7 @@ typedef struct system_variables
   uint in_subquery_conversion_threshold;
   ulong optimizer_max_sel_arg_weight;
   ulonglong max_rowid_filter_size;
+  ulonglong optimizer_max_join_prefixes;
 
   vers_asof_timestamp_t vers_asof_timestamp;
   ulong vers_alter_history;
@@ -2412,6 +2413,8 @@ class Gap_time_tracker_data
 
   Gap_time_tracker *bill_to;
   ulonglong start_time;
+  /* Whether the interval follows a sampled call */
+  bool sampled;
 
   void init() { bill_to = NULL; }
 };
@@ -6623,6 +6626,12 @@ class select_union_direct :public select_unit
   bool postponed_prepare(List<Item> &types);
   bool send_result_set_metadata(List<Item> &list, uint flags);
   int send_data(List<Item> &items);
+  /*
+    Number of rows, including the rows to be skipped by OFFSET, that the
+    SELECTs of the union may still send, or HA_POS_ERROR if not known yet
+  */
+  ha_rows rows_left() const
+  { return done_send_result_set_metadata ? limit : HA_POS_ERROR; }
   bool initialize_tables (JOIN *join);
   bool send_eof();
   bool flush() { return false; }
@@ -23,6 +23,7 @@
 #include "sql_cursor.h"
 #include "probes_mysql.h"
 #include "sql_parse.h"                        // mysql_execute_command
+#include "sql_select.h"                       // JOIN
 
 /****************************************************************************
   Declarations.
@@ -428,12 +429,49 @@ void Materialized_cursor::on_table_fill_finished()
  Select_materialize
 ****************************************************************************/
 
+/**
+  Check if the result of a cursor query is not expected to fit into
+  an in-memory temporary table.
+
+  Such a result would be written into a HEAP table first and copied to
+  a disk table when the HEAP table becomes full, which writes every row
+  twice and delays the first FETCH. Use SQL_BIG_RESULT or the optimizer
+  estimate of the number of rows to detect this beforehand.
+*/
+
+static bool is_big_cursor_result(THD *thd, SELECT_LEX_UNIT *unit,
+                                 List<Item> &list)
+{
+  if (unit->is_unit_op())
+    return false;
+  JOIN *join= unit->first_select()->join;
+  if (!join || join->zero_result_cause || join->implicit_grouping ||
+      join->group_list)
+    return false;
+  if (join->select_options & SELECT_BIG_RESULT)
+    return true;
+  if (join->table_count <= join->const_tables)
+    return false;
+
+  double rows= MY_MIN(join->join_record_count, (double) join->select_limit);
+  ulonglong row_length= 0;
+  List_iterator_fast<Item> it(list);
+  Item *item;
+  while ((item= it++))
+    row_length+= item->max_length;
+  return rows * (double) row_length >
+         (double) thd->variables.tmp_memory_table_size;
+}
+
+
 bool Select_materialize::send_result_set_metadata(List<Item> &list, uint flags)
 {
+  ulonglong options= thd->variables.option_bits | TMP_TABLE_ALL_COLUMNS;
   DBUG_ASSERT(table == 0);
+  if (is_big_cursor_result(thd, unit, list))
+    options|= TMP_TABLE_FORCE_MYISAM;
   if (create_result_table(unit->thd, unit->get_column_types(true),
-                          FALSE,
-                          thd->variables.option_bits | TMP_TABLE_ALL_COLUMNS,
+                          FALSE, options,
                           &empty_clex_str, FALSE, TRUE, TRUE, 0))
     return TRUE;
 
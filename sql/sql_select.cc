@@ -1457,7 +1457,27 @@ JOIN::prepare(TABLE_LIST *tables_init, COND *conds_init, uint og_num,
     }
   }
 
-  if (setup_fields(thd, ref_ptrs, fields_list, MARK_COLUMNS_READ,
+  /*
+    The select list of a simple EXISTS subquery is never evaluated:
+    select_exists_subselect::send_data() only notes that a row was found,
+    and the EXISTS-to-IN rewrite replaces the list with columns of the
+    WHERE clause, which are marked on their own.  Resolve the list without
+    marking its columns, so that the engine does not fetch and convert
+    them (e.g. off-page BLOBs) and a covering index can still be used.
+  */
+  enum_column_usage select_list_usage= MARK_COLUMNS_READ;
+  if (select_lex->master_unit()->item &&
+      select_lex->master_unit()->item->substype() ==
+      Item_subselect::EXISTS_SUBS &&
+      select_lex->master_unit()->first_select() == select_lex &&
+      !select_lex->next_select() &&
+      !select_lex->with_sum_func && !select_lex->have_window_funcs() &&
+      !select_lex->group_list.elements && !having &&
+      !select_lex->order_list.elements &&
+      !thd->lex->is_view_context_analysis())
+    select_list_usage= COLUMNS_READ;
+
+  if (setup_fields(thd, ref_ptrs, fields_list, select_list_usage,
                    &all_fields, &select_lex->pre_fix, 1))
     DBUG_RETURN(-1);
   thd->lex->current_select->context_analysis_place= save_place;
@@ -8857,6 +8877,9 @@ choose_plan(JOIN *join, table_map join_tables)
   join->cur_embedding_map= 0;
   join->extra_heuristic_pruning= false;
   join->prune_level= join->thd->variables.optimizer_prune_level;
+  join->join_prefixes_left= (thd->variables.optimizer_max_join_prefixes ?
+                             thd->variables.optimizer_max_join_prefixes :
+                             ULONGLONG_MAX);
 
   reset_nj_counters(join, join->join_list);
   qsort2_cmp jtab_sort_func;
@@ -10309,6 +10332,25 @@ best_extension_by_limited_search(JOIN      *join,
                                 "part_plan"););
   status_var_increment(thd->status_var.optimizer_join_prefixes_check_calls);
 
+  if (!join->join_prefixes_left)
+  {
+    /*
+      optimizer_max_join_prefixes has been reached. Once some plan has been
+      found, do not extend this prefix any further. greedy_search() will
+      then add the remaining tables one by one, each time following only
+      the first promising extension.
+    */
+    if (join->best_read < DBL_MAX)
+    {
+      Json_writer_object trace_limit(thd);
+      trace_limit.add("pruned_by_max_join_prefixes", true);
+      *processed_eq_ref_tables= 0;
+      DBUG_RETURN(SEARCH_OK);
+    }
+  }
+  else
+    join->join_prefixes_left--;
+
   if (join->emb_sjm_nest)
   {
     /*
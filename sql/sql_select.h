@@ -1336,6 +1336,11 @@ class JOIN :public Sql_alloc
     optimizer_extra_pruning_depth)
   */
   bool extra_heuristic_pruning;
+  /*
+    How many more join prefixes may be examined before the join order
+    search is cut down (based on optimizer_max_join_prefixes)
+  */
+  ulonglong join_prefixes_left;
 #ifndef DBUG_OFF
   void dbug_verify_sj_inner_tables(uint n_positions) const;
   int dbug_join_tab_array_size;
@@ -11558,6 +11558,16 @@ copy_data_between_tables(THD *thd, TABLE *from, TABLE *to,
   if (dfield_ptr)
     *dfield_ptr= NULL;
 
+  /* Copy each run of unchanged adjacent columns with a single memcpy() */
+  if (copy != copy_end)
+  {
+    Copy_field *last= copy;
+    for (Copy_field *copy_ptr= copy + 1; copy_ptr != copy_end; copy_ptr++)
+      if (!last->merge(*copy_ptr) && ++last != copy_ptr)
+        *last= *copy_ptr;
+    copy_end= last + 1;
+  }
+
   if (order)
   {
     if (to->s->primary_key != MAX_KEY &&
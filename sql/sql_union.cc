@@ -1026,7 +1026,15 @@ bool select_union_direct::send_eof()
 
   if (unit->thd->lex->current_select == last_select_lex)
   {
-    thd->limit_found_rows= limit_found_rows;
+    /*
+      Without SQL_CALC_FOUND_ROWS, st_select_lex_unit::exec() stops the
+      SELECTs once the global LIMIT has been reached, so the sum of their
+      row counts means nothing. FOUND_ROWS() then returns the number of
+      rows in the result set, as it does for a single SELECT.
+    */
+    thd->limit_found_rows=
+      (unit->first_select()->options & OPTION_FOUND_ROWS) ?
+      limit_found_rows : send_records;
 
     // Reset and make ready for re-execution
     done_send_result_set_metadata= false;
@@ -2205,6 +2213,23 @@ bool st_select_lex_unit::exec()
           fake_select_lex->uncacheable= 0;
       }
 
+      /*
+        INTERSECT and EXCEPT are applied to the rows collected so far.
+        If there are none, the result stays empty whatever this SELECT
+        returns, so there is no need to execute it. (It has already been
+        optimized by optimize().) The row count was updated by info() after
+        the previous SELECT.
+        The ALL variants are not skipped, because select_unit_ext::send_eof()
+        also switches the indexes of the table off for the following SELECTs.
+      */
+      bool skip_select= (sl != select_cursor && fake_select_lex &&
+                         !describe && !have_except_all_or_intersect_all &&
+                         (sl->get_linkage() == INTERSECT_TYPE ||
+                          sl->get_linkage() == EXCEPT_TYPE) &&
+                         !table->file->stats.records);
+      bool limit_reached= false;
+
+      if (!skip_select)
       {
         set_limit(sl);
 	if (sl == global_parameters() || describe)
@@ -2218,6 +2243,26 @@ bool st_select_lex_unit::exec()
 	    lim.set_unlimited();
         }
 
+        /*
+          select_union_direct applies the global LIMIT to the rows of all
+          SELECTs of a UNION ALL. A SELECT following the first one needs to
+          send no more rows than are still allowed, so let end_send() stop
+          reading once it has sent them. The JOIN has already been
+          optimized by optimize(), so the capped limit does not affect the
+          plan, and a SELECT that may not send any rows is not executed at
+          all. This is only done for the top-level unit of the statement.
+        */
+        if (sl != select_cursor && this == &thd->lex->unit &&
+            union_result && !fake_select_lex && !found_rows_for_union &&
+            !describe && !lim.is_with_ties())
+        {
+          ha_rows left= ((select_union_direct*) union_result)->rows_left();
+          if (!left)
+            limit_reached= true;
+          else if (left < lim.get_select_limit() - lim.get_offset_limit())
+            lim.set_limit(left, lim.get_offset_limit(), false);
+        }
+
         /*
           When using braces, SQL_CALC_FOUND_ROWS affects the whole query:
           we don't calculate found_rows() per union part.
@@ -2241,10 +2286,22 @@ bool st_select_lex_unit::exec()
       if (likely(!saved_error))
       {
 	records_at_start= table->file->stats.records;
-	if (sl->tvc)
-	  sl->tvc->exec(sl);
-	else
-	  sl->join->exec();
+        if (limit_reached)
+        {
+          /* The result set still has to be ended after the last SELECT */
+          if (!sl->next_select())
+          {
+            thd->limit_found_rows= 0;
+            saved_error= union_result->send_eof();
+          }
+        }
+        else if (!skip_select)
+        {
+          if (sl->tvc)
+            sl->tvc->exec(sl);
+          else
+            sl->join->exec();
+        }
         if (sl == union_distinct && !have_except_all_or_intersect_all &&
             !(with_element && with_element->is_recursive))
 	{
@@ -2254,7 +2311,7 @@ bool st_select_lex_unit::exec()
 	    DBUG_RETURN(TRUE);
 	  table->no_keyread=1;
 	}
-	if (!sl->tvc)
+	if (!sl->tvc && !skip_select && !limit_reached)
 	  saved_error= sl->join->error;
 	if (likely(!saved_error))
 	{
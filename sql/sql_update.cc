@@ -1012,6 +1012,14 @@ int mysql_update(THD *thd,
   table->file->prepare_for_insert(1);
   DBUG_ASSERT(table->file->inited != handler::NONE);
 
+  /*
+    The history rows are logged with the row image of the statement.
+    The column maps do not change between rows, so compute it only once
+    instead of for every inserted history row.
+  */
+  if (has_vers_fields && table->versioned(VERS_TIMESTAMP))
+    table->mark_columns_per_binlog_row_image();
+
   THD_STAGE_INFO(thd, stage_updating);
   fix_rownum_pointers(thd, thd->lex->current_select, &updated_or_same);
   thd->get_stmt_da()->reset_current_row_for_warning(1);
@@ -1136,7 +1144,6 @@ int mysql_update(THD *thd,
       if (likely(!error) && has_vers_fields && table->versioned(VERS_TIMESTAMP))
       {
         store_record(table, record[2]);
-        table->mark_columns_per_binlog_row_image();
         error= vers_insert_history_row(table);
         restore_record(table, record[2]);
         if (unlikely(error))
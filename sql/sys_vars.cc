@@ -2832,6 +2832,14 @@ static Sys_var_ulong Sys_optimizer_extra_pruning_depth(
        SESSION_VAR(optimizer_extra_pruning_depth), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(0, MAX_TABLES+1), DEFAULT(8), BLOCK_SIZE(1));
 
+static Sys_var_ulonglong Sys_optimizer_max_join_prefixes(
+       "optimizer_max_join_prefixes",
+       "The maximum number of join prefixes the optimizer examines when "
+       "choosing the join order. When it is reached, the rest of the join "
+       "order is chosen greedily. Set to 0 for no limit",
+       SESSION_VAR(optimizer_max_join_prefixes), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, ULONGLONG_MAX), DEFAULT(0), BLOCK_SIZE(1));
+
 /* this is used in the sigsegv handler */
 export const char *optimizer_switch_names[]=
 {
@@ -51,6 +51,7 @@ Created 10/16/1994 Heikki Tuuri
 #include "rem0rec.h"
 #include "rem0cmp.h"
 #include "buf0lru.h"
+#include "buf0rea.h"
 #include "btr0btr.h"
 #include "btr0sea.h"
 #include "row0log.h"
@@ -7387,6 +7388,8 @@ btr_copy_blob_prefix(
 	uint32_t	offset)	/*!< in: offset on the first BLOB page */
 {
 	ulint	copied_len	= 0;
+	/* Pages below this have been submitted for read-ahead */
+	uint32_t read_ahead_end	= 0;
 
 	for (;;) {
 		mtr_t		mtr;
@@ -7395,6 +7398,7 @@ btr_copy_blob_prefix(
 		const byte*	blob_header;
 		ulint		part_len;
 		ulint		copy_len;
+		const uint32_t	page_no = id.page_no();
 
 		mtr_start(&mtr);
 
@@ -7422,6 +7426,24 @@ btr_copy_blob_prefix(
 			return(copied_len);
 		}
 
+		if (id.page_no() == page_no + 1
+		    && id.page_no() >= read_ahead_end) {
+			/* The BLOB pages appear to have been allocated
+			consecutively. Read the pages that we are going
+			to need next asynchronously, instead of waiting
+			for one synchronous read per page. */
+			const ulint n_pages = 1 + (len - copied_len)
+				/ (srv_page_size - FIL_PAGE_DATA
+				   - BTR_BLOB_HDR_SIZE - FIL_PAGE_DATA_END);
+			if (n_pages > 1) {
+				buf_read_ahead_blob(id, n_pages);
+			}
+			read_ahead_end = id.page_no()
+				+ uint32_t(std::min<ulint>(
+						   n_pages,
+						   buf_pool.read_ahead_area));
+		}
+
 		/* On other BLOB pages except the first the BLOB header
 		always is at the page data start: */
 
@@ -1079,6 +1079,25 @@ bool buf_pool_t::create()
   zip_hash.create(2 * curr_size);
   last_printout_time= time(NULL);
 
+  LRU_ghost= nullptr;
+  LRU_ghost_size= 0;
+  if (buf_LRU_policy == BUF_LRU_2Q)
+  {
+    LRU_ghost= static_cast<uint64_t*>
+      (ut_malloc_nokey(curr_size * sizeof *LRU_ghost));
+    if (LRU_ghost)
+    {
+      memset(LRU_ghost, 0xff, curr_size * sizeof *LRU_ghost);
+      LRU_ghost_size= curr_size;
+    }
+    else
+    {
+      ib::warn() << "Cannot allocate memory for"
+                    " innodb_buffer_pool_lru_policy=2Q; using midpoint";
+      buf_LRU_policy= BUF_LRU_MIDPOINT;
+    }
+  }
+
   mysql_mutex_init(flush_list_mutex_key, &flush_list_mutex,
                    MY_MUTEX_INIT_FAST);
 
@@ -1160,6 +1179,8 @@ void buf_pool_t::close()
   chunks= nullptr;
   page_hash.free();
   zip_hash.free();
+  ut_free(LRU_ghost);
+  LRU_ghost= nullptr;
 
   io_buf.close();
   UT_DELETE(chunk_t::map_reg);
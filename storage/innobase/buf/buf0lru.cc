@@ -106,6 +106,9 @@ least this many milliseconds ago.  Not protected by any mutex or latch. */
 uint	buf_LRU_old_threshold_ms;
 /* @} */
 
+/** innodb_buffer_pool_lru_policy */
+ulong	buf_LRU_policy;
+
 /** Remove bpage from buf_pool.LRU and buf_pool.page_hash.
 
 If !bpage->frame && bpage->oldest_modification() <= 1,
@@ -847,6 +850,10 @@ bool buf_LRU_free_page(buf_page_t *bpage, bool zip)
 
 	ut_ad(bpage->can_relocate());
 
+	if (!b && bpage->old) {
+		buf_pool.LRU_ghost_add(id);
+	}
+
 	if (!buf_LRU_block_remove_hashed(bpage, id, chain, zip)) {
 		ut_ad(!b);
 		mysql_mutex_assert_not_owner(&buf_pool.flush_list_mutex);
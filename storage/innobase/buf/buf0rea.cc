@@ -158,7 +158,7 @@ static buf_page_t* buf_page_init_for_read(ulint mode, const page_id_t page_id,
     }
 
     /* The block must be put to the LRU list, to the old blocks */
-    buf_LRU_add_block(&block->page, true/* to old blocks */);
+    buf_LRU_add_block(&block->page, !buf_pool.LRU_ghost_hit(page_id));
 
     if (UNIV_UNLIKELY(zip_size))
     {
@@ -223,7 +223,7 @@ static buf_page_t* buf_page_init_for_read(ulint mode, const page_id_t page_id,
 
     /* The block must be put to the LRU list, to the old blocks.
     The zip size is already set into the page zip */
-    buf_LRU_add_block(bpage, true/* to old blocks */);
+    buf_LRU_add_block(bpage, !buf_pool.LRU_ghost_hit(page_id));
   }
 
   mysql_mutex_unlock(&buf_pool.mutex);
@@ -432,6 +432,58 @@ buf_read_ahead_random(const page_id_t page_id, ulint zip_size, bool ibuf)
   return count;
 }
 
+/** Issue asynchronous read requests for the next pages of an externally
+stored column. The pages of a BLOB are usually allocated at consecutive
+page numbers, but the successor of a BLOB page is only known after it has
+been read. NOTE: the calling thread may own latches on pages.
+@param page_id   the first page to read
+@param n_pages   number of consecutive pages to read
+@return number of page read requests issued */
+ulint buf_read_ahead_blob(const page_id_t page_id, ulint n_pages)
+{
+  if (srv_startup_is_before_trx_rollback_phase)
+    /* No read-ahead to avoid thread deadlocks */
+    return 0;
+
+  if (buf_pool.n_pend_reads > buf_pool.curr_size / BUF_READ_AHEAD_PEND_LIMIT)
+    return 0;
+
+  fil_space_t *space= fil_space_t::get(page_id.space());
+  if (!space)
+    return 0;
+
+  const ulint zip_size= space->zip_size();
+  page_id_t high= page_id + uint32_t(std::min<ulint>
+                                     (n_pages, buf_pool.read_ahead_area));
+  high.set_page_no(std::min(high.page_no(), space->last_page_number() + 1));
+  ulint count= 0;
+
+  for (page_id_t i= page_id; i < high; ++i)
+  {
+    if (ibuf_bitmap_page(i, zip_size) || trx_sys_hdr_page(i))
+      continue;
+    if (space->is_stopping())
+      break;
+    dberr_t err;
+    space->reacquire();
+    if (buf_read_page_low(&err, space, false, BUF_READ_ANY_PAGE, i, zip_size,
+                          false))
+      count++;
+  }
+
+  if (count)
+    DBUG_PRINT("ib_buf", ("BLOB read-ahead %zu pages from %s: %u",
+			  count, space->chain.start->name,
+			  page_id.page_no()));
+  space->release();
+
+  buf_LRU_stat_inc_io();
+
+  buf_pool.stat.n_ra_pages_read+= count;
+  srv_stats.buf_pool_reads.add(count);
+  return count;
+}
+
 /** High-level function which reads a page from a file to buf_pool
 if it is not already there. Sets the io_fix and an exclusive lock
 on the buffer frame. The flag is cleared and the x-lock
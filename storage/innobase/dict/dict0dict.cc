@@ -1345,38 +1345,53 @@ ulint dict_sys_t::evict_table_LRU(bool half)
 	extern ulong tdc_size;
 	const ulint max_tables = tdc_size;
 #endif
+	/* Maximum number of table_LRU entries to examine while holding
+	the exclusive latch. Between batches, the latch is released so
+	that threads opening or creating tables are not blocked for the
+	duration of a scan of a large cache. */
+	constexpr ulint batch_size = 64;
 	ulint n_evicted = 0;
 
-	lock(SRW_LOCK_CALL);
-	ut_ad(dict_lru_validate());
-
+	freeze(SRW_LOCK_CALL);
 	const ulint len = UT_LIST_GET_LEN(table_LRU);
+	unfreeze();
 
 	if (len < max_tables) {
-func_exit:
-		unlock();
 		return(n_evicted);
 	}
 
-	const ulint check_up_to = half ? len / 2 : 0;
-	ulint i = len;
-
 	/* Find a suitable candidate to evict from the cache. Don't scan the
-	entire LRU list. Only scan pct_check list entries. */
+	entire LRU list when half is requested. */
+	ulint n_scan = half ? len - len / 2 : len;
+
+	while (n_scan) {
+		lock(SRW_LOCK_CALL);
+		ut_ad(dict_lru_validate());
 
-	for (dict_table_t *table = UT_LIST_GET_LAST(table_LRU);
-	     table && i > check_up_to && (len - n_evicted) > max_tables; --i) {
-		dict_table_t* prev_table = UT_LIST_GET_PREV(table_LRU, table);
+		for (ulint i = batch_size; i && n_scan; i--, n_scan--) {
+			if (UT_LIST_GET_LEN(table_LRU) <= max_tables) {
+				n_scan = 0;
+				break;
+			}
+
+			dict_table_t* table = UT_LIST_GET_LAST(table_LRU);
 
-		if (dict_table_can_be_evicted(table)) {
-			remove(table, true);
-			++n_evicted;
+			if (dict_table_can_be_evicted(table)) {
+				remove(table, true);
+				++n_evicted;
+			} else {
+				/* The table is in use. Move it to the
+				head, so that the next batch will not
+				start by examining it again. */
+				UT_LIST_REMOVE(table_LRU, table);
+				UT_LIST_ADD_FIRST(table_LRU, table);
+			}
 		}
 
-		table = prev_table;
+		unlock();
 	}
 
-	goto func_exit;
+	return(n_evicted);
 }
 
 /** Looks for an index with the given id given a table instance.
@@ -32,6 +32,7 @@ Modified           Jan Lindström jan.lindstrom@mariadb.com
 # include "buf0buf.h"
 #else
 #include "buf0dblwr.h"
+#include "buf0rea.h"
 #include "srv0srv.h"
 #include "srv0start.h"
 #include "mtr0mtr.h"
@@ -1037,6 +1038,10 @@ struct rotate_thread_t {
   uint allocated_iops = 0;     /*!< allocated iops */
   ulint cnt_waited = 0;	       /*!< #times waited during this slot */
   uintmax_t sum_waited_us = 0; /*!< wait time during this slot */
+  uint32_t read_ahead_start = 0; /*!< first page of the read-ahead */
+  uint64_t read_ahead = 0;     /*!< bitmap of the pages, relative to
+                               read_ahead_start, that the read-ahead
+                               counted in pages_read_from_disk */
 
 	fil_crypt_stat_t crypt_stat; // statistics
 
@@ -1669,8 +1674,14 @@ fil_crypt_get_page_throttle(
 					      NULL,
 					      BUF_PEEK_IF_IN_POOL, mtr);
 	if (block != NULL) {
-		/* page was in buffer pool */
-		state->crypt_stat.pages_read_from_cache++;
+		/* page was in buffer pool, unless
+		fil_crypt_read_ahead() read it */
+		const uint32_t i = offset - state->read_ahead_start;
+		if (i >= 64 || !(state->read_ahead >> i & 1)) {
+			state->crypt_stat.pages_read_from_cache++;
+		} else {
+			state->read_ahead &= ~(1ULL << i);
+		}
 		return block;
 	}
 
@@ -1715,6 +1726,20 @@ fil_crypt_get_page_throttle(
 	return block;
 }
 
+/** Sleep in order to keep within innodb_encryption_rotation_iops.
+@param sleeptime_ms  sleep time in milliseconds, or 0 */
+static void fil_crypt_throttle_sleep(ulint sleeptime_ms)
+{
+	if (sleeptime_ms) {
+		mysql_mutex_lock(&fil_crypt_threads_mutex);
+		timespec abstime;
+		set_timespec_nsec(abstime, 1000000ULL * sleeptime_ms);
+		my_cond_timedwait(&fil_crypt_throttle_sleep_cond,
+				  &fil_crypt_threads_mutex.m_mutex, &abstime);
+		mysql_mutex_unlock(&fil_crypt_threads_mutex);
+	}
+}
+
 /***********************************************************************
 Rotate one page
 @param[in,out]		key_state		Key state
@@ -1835,14 +1860,47 @@ fil_crypt_rotate_page(
 		mtr.commit();
 	}
 
-	if (sleeptime_ms) {
-		mysql_mutex_lock(&fil_crypt_threads_mutex);
-		timespec abstime;
-		set_timespec_nsec(abstime, 1000000ULL * sleeptime_ms);
-		my_cond_timedwait(&fil_crypt_throttle_sleep_cond,
-				  &fil_crypt_threads_mutex.m_mutex, &abstime);
-		mysql_mutex_unlock(&fil_crypt_threads_mutex);
-	}
+	fil_crypt_throttle_sleep(sleeptime_ms);
+}
+
+/** Read the allocated pages of a batch up to the end of the current
+read-ahead area asynchronously, so that fil_crypt_get_page_throttle() will
+find them in the buffer pool instead of reading them one at a time.
+@param[in,out]	state	rotation state
+@param[in]	end	end of the batch
+@return sleep time in milliseconds for the pages that were read */
+static ulint fil_crypt_read_ahead(rotate_thread_t *state, uint32_t end)
+{
+  fil_space_t *space= &*state->space;
+  const ulint zip_size= space->zip_size();
+  const uint32_t area= buf_pool.read_ahead_area;
+  const uint32_t last= std::min(end, (state->offset / area + 1) * area);
+  ulint n_read= 0;
+
+  ut_ad(last - state->offset <= 64);
+  state->read_ahead_start= state->offset;
+  state->read_ahead= 0;
+
+  for (uint32_t offset= state->offset; offset < last; offset++)
+  {
+    const page_id_t page_id(space->id, offset);
+    if (space->is_stopping())
+      break;
+    if (buf_dblwr.is_inside(page_id))
+      continue;
+    buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(page_id.fold());
+    if (buf_pool.page_hash_contains(page_id, chain) ||
+        fseg_page_is_allocated(space, offset) != DB_SUCCESS_LOCKED_REC)
+      continue;
+    space->reacquire();
+    buf_read_page_background(space, page_id, zip_size);
+    state->read_ahead|= 1ULL << (offset - state->offset);
+    n_read++;
+  }
+
+  state->crypt_stat.pages_read_from_disk+= n_read;
+  /* Keep within the allocated innodb_encryption_rotation_iops. */
+  return n_read * 1000 / state->allocated_iops;
 }
 
 /***********************************************************************
@@ -1861,7 +1919,18 @@ fil_crypt_rotate_pages(
 
 	ut_ad(state->space->referenced());
 
-	for (; state->offset < end; state->offset++) {
+	for (uint32_t read_ahead_end = state->offset;
+	     state->offset < end; state->offset++) {
+
+		if (state->offset >= read_ahead_end) {
+			/* Read the rest of the read-ahead area at once
+			rather than page by page. */
+			fil_crypt_throttle_sleep(
+				fil_crypt_read_ahead(state, end));
+			read_ahead_end = std::min(
+				end, (state->offset / buf_pool.read_ahead_area
+				      + 1) * buf_pool.read_ahead_area);
+		}
 
 		/* we can't rotate pages in dblwr buffer as
 		* it's not possible to read those due to lots of asserts
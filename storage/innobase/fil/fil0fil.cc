@@ -42,6 +42,7 @@ Created 10/25/1995 Heikki Tuuri
 #include "os0file.h"
 #include "page0zip.h"
 #include "row0mysql.h"
+#include "srv0mon.h"
 #include "srv0start.h"
 #include "trx0purge.h"
 #include "buf0lru.h"
@@ -72,30 +73,52 @@ ATTRIBUTE_COLD void fil_space_t::set_corrupted() const
 bool fil_space_t::try_to_close(bool print_info)
 {
   mysql_mutex_assert_owner(&fil_system.mutex);
-  for (fil_space_t &space : fil_system.space_list)
+  /* The first tablespace that was moved to the end of space_list */
+  const fil_space_t *moved= nullptr;
+
+  for (auto it= fil_system.space_list.begin();
+       it != fil_system.space_list.end(); )
   {
+    fil_space_t &space= *it++;
+    if (&space == moved)
+      break;
+
+    /* We are using an approximation of LRU replacement policy. In
+    fil_node_open_file_low(), newly opened files are moved to the end
+    of fil_system.space_list, so that they would be less likely to be
+    closed here. Tablespaces that cannot be closed here are moved to
+    the end as well, so that with a large number of tablespaces the
+    start of the list will consist of candidates for closing, instead
+    of having to be skipped on every invocation. */
+    fil_node_t *node= UT_LIST_GET_FIRST(space.chain);
+
     switch (space.purpose) {
     case FIL_TYPE_TEMPORARY:
-      continue;
+      goto skip;
     case FIL_TYPE_IMPORT:
       break;
     case FIL_TYPE_TABLESPACE:
       if (is_predefined_tablespace(space.id))
-        continue;
+        goto skip;
     }
 
-    /* We are using an approximation of LRU replacement policy. In
-    fil_node_open_file_low(), newly opened files are moved to the end
-    of fil_system.space_list, so that they would be less likely to be
-    closed here. */
-    fil_node_t *node= UT_LIST_GET_FIRST(space.chain);
     if (!node)
       /* fil_ibd_create() did not invoke fil_space_t::add() yet */
       continue;
     ut_ad(!UT_LIST_GET_NEXT(chain, node));
 
     if (!node->is_open())
+    {
+skip:
+      if (UNIV_LIKELY(!fil_system.freeze_space_list))
+      {
+        fil_system.space_list.erase(space_list_t::iterator(&space));
+        fil_system.space_list.push_back(space);
+        if (!moved)
+          moved= &space;
+      }
       continue;
+    }
 
     if (const auto n= space.set_closing())
     {
@@ -119,6 +142,13 @@ bool fil_space_t::try_to_close(bool print_info)
     }
 
     node->close();
+    MONITOR_INC(MONITOR_FILE_CLOSED);
+
+    if (UNIV_LIKELY(!fil_system.freeze_space_list))
+    {
+      fil_system.space_list.erase(space_list_t::iterator(&space));
+      fil_system.space_list.push_back(space);
+    }
     return true;
   }
 
@@ -402,6 +432,7 @@ static bool fil_node_open_file_low(fil_node_t *node)
   }
 
   fil_system.n_open++;
+  MONITOR_INC(MONITOR_FILE_OPENED);
   return true;
 }
 
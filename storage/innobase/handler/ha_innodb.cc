@@ -374,6 +374,21 @@ TYPELIB innodb_flush_method_typelib = {
 	NULL
 };
 
+/** Names of allowed values of innodb_buffer_pool_lru_policy */
+static const char *innodb_buffer_pool_lru_policy_names[]= {
+	"midpoint",
+	"2Q",
+	NullS
+};
+
+/** Enumeration of innodb_buffer_pool_lru_policy */
+static TYPELIB innodb_buffer_pool_lru_policy_typelib = {
+	array_elements(innodb_buffer_pool_lru_policy_names) - 1,
+	"innodb_buffer_pool_lru_policy_typelib",
+	innodb_buffer_pool_lru_policy_names,
+	NULL
+};
+
 /** Names of allowed values of innodb_deadlock_report */
 static const char *innodb_deadlock_report_names[]= {
 	"off", /* Do not report any details of deadlocks */
@@ -878,6 +893,11 @@ static MYSQL_THDVAR_BOOL(strict_mode, PLUGIN_VAR_OPCMDARG,
   "Use strict mode when evaluating create options.",
   NULL, NULL, TRUE);
 
+static MYSQL_THDVAR_BOOL(table_condition_pushdown, PLUGIN_VAR_OPCMDARG,
+  "Skip records that do not satisfy simple comparisons of the WHERE clause"
+  " before converting them from the InnoDB format",
+  NULL, NULL, FALSE);
+
 static MYSQL_THDVAR_BOOL(ft_enable_stopword, PLUGIN_VAR_OPCMDARG,
   "Create FTS index with stopword.",
   NULL, NULL,
@@ -937,6 +957,8 @@ static SHOW_VAR innodb_status_variables[]= {
    &export_vars.innodb_buffer_pool_pages_misc, SHOW_SIZE_T},
   {"buffer_pool_pages_old",
    &export_vars.innodb_buffer_pool_pages_old, SHOW_SIZE_T},
+  {"buffer_pool_pages_read_young",
+   &export_vars.innodb_buffer_pool_pages_read_young, SHOW_SIZE_T},
   {"buffer_pool_pages_total",
    &export_vars.innodb_buffer_pool_pages_total, SHOW_SIZE_T},
   {"buffer_pool_pages_LRU_flushed", &buf_lru_flush_page_count, SHOW_SIZE_T},
@@ -2983,6 +3005,7 @@ ha_innobase::ha_innobase(
 	TABLE_SHARE*	table_arg)
 	:handler(hton, table_arg),
 	m_prebuilt(),
+	m_table_cond(),
 	m_user_thd(),
 	m_int_table_flags(HA_REC_NOT_IN_SEQ
 			  | HA_NULL_IN_KEY
@@ -3550,6 +3573,10 @@ ha_innobase::reset_template(void)
 		m_prebuilt->pk_filter = NULL;
 		m_prebuilt->template_type = ROW_MYSQL_NO_TEMPLATE;
 	}
+	if (m_prebuilt->table_cond) {
+		m_prebuilt->table_cond = NULL;
+		m_prebuilt->template_type = ROW_MYSQL_NO_TEMPLATE;
+	}
 }
 
 /*****************************************************************//**
@@ -5000,6 +5027,10 @@ ha_innobase::table_flags() const
 	THD*			thd = ha_thd();
 	handler::Table_flags	flags = m_int_table_flags;
 
+	if (THDVAR(thd, table_condition_pushdown)) {
+		flags |= HA_CAN_TABLE_CONDITION_PUSHDOWN;
+	}
+
 	/* Need to use tx_isolation here since table flags is (also)
 	called before prebuilt is inited. */
 
@@ -7130,6 +7161,7 @@ build_template_field(
 	templ->rec_field_is_prefix = FALSE;
 	templ->rec_prefix_field_no = ULINT_UNDEFINED;
 	templ->is_virtual = !field->stored_in_db();
+	templ->is_table_cond = false;
 
 	if (!templ->is_virtual) {
 		templ->col_no = i;
@@ -7276,6 +7308,32 @@ build_template_field(
 	return(templ);
 }
 
+/** Mark a column that is needed for evaluating a pushed table condition.
+@param[in]	field		column
+@param[in]	table		MySQL table object
+@param[in,out]	prebuilt	prebuilt struct with a built template
+@return whether the column is in the template */
+static
+bool
+innobase_mark_table_cond_field(
+	const Field*	field,
+	const TABLE*	table,
+	row_prebuilt_t*	prebuilt)
+{
+	const ulint	offset = get_field_offset(table, field);
+
+	for (ulint i = 0; i < prebuilt->n_template; i++) {
+		mysql_row_templ_t*	templ = &prebuilt->mysql_template[i];
+
+		if (!templ->is_virtual && templ->mysql_col_offset == offset) {
+			templ->is_table_cond = true;
+			return(true);
+		}
+	}
+
+	return(false);
+}
+
 /**************************************************************//**
 Builds a 'template' to the m_prebuilt struct. The template is used in fast
 retrieval of just those column values MySQL needs in its processing. */
@@ -7643,6 +7701,37 @@ ha_innobase::build_template(
 			templ->rec_field_no = templ->clust_rec_field_no;
 		}
 	}
+
+	m_prebuilt->table_cond = NULL;
+
+	if (!m_table_cond
+	    || m_prebuilt->idx_cond || m_prebuilt->pk_filter
+	    || m_prebuilt->select_lock_type != LOCK_NONE
+	    || m_prebuilt->in_fts_query) {
+		return;
+	}
+
+	for (uint i = 0; i < n_fields; i++) {
+		if (bitmap_is_set(&m_table_cond_fields, i)
+		    && !innobase_mark_table_cond_field(
+			    table->field[i], table, m_prebuilt)) {
+			return;
+		}
+	}
+
+	/* handler_table_cond_check() may compare the key with end_range. */
+	if (active_index != MAX_KEY) {
+		const KEY& key = table->key_info[active_index];
+
+		for (uint i = 0; i < key.user_defined_key_parts; i++) {
+			if (!innobase_mark_table_cond_field(
+				    key.key_part[i].field, table, m_prebuilt)) {
+				return;
+			}
+		}
+	}
+
+	m_prebuilt->table_cond = this;
 }
 
 /********************************************************************//**
@@ -7664,8 +7753,8 @@ ha_innobase::innobase_lock_autoinc(void)
 
 	switch (innobase_autoinc_lock_mode) {
 	case AUTOINC_NO_LOCKING:
-		/* Acquire only the AUTOINC mutex. */
-		m_prebuilt->table->autoinc_mutex.wr_lock();
+		/* Values are allocated by compare-and-swap on
+		dict_table_t::autoinc; see get_auto_increment(). */
 		break;
 
 	case AUTOINC_NEW_STYLE_LOCKING:
@@ -7709,6 +7798,14 @@ ha_innobase::innobase_lock_autoinc(void)
 	DBUG_RETURN(error);
 }
 
+/** Release the AUTOINC mutex after innobase_lock_autoinc() succeeded. */
+inline void ha_innobase::innobase_unlock_autoinc()
+{
+	if (innobase_autoinc_lock_mode != AUTOINC_NO_LOCKING) {
+		m_prebuilt->table->autoinc_mutex.wr_unlock();
+	}
+}
+
 /********************************************************************//**
 Store the autoinc value in the table. The autoinc value is only set if
 it's greater than the existing autoinc value in the table.
@@ -7726,7 +7823,7 @@ ha_innobase::innobase_set_max_autoinc(
 	if (error == DB_SUCCESS) {
 
 		dict_table_autoinc_update_if_greater(m_prebuilt->table, auto_inc);
-		m_prebuilt->table->autoinc_mutex.wr_unlock();
+		innobase_unlock_autoinc();
 	}
 
 	return(error);
@@ -15652,6 +15749,8 @@ ha_innobase::reset()
 
 	m_ds_mrr.dsmrr_close();
 
+	m_table_cond = NULL;
+
 	/* TODO: This should really be reset in reset_template() but for now
 	it's safer to do it explicitly here. */
 
@@ -16418,7 +16517,8 @@ ha_innobase::store_lock(
 /*********************************************************************//**
 Read the next autoinc value. Acquire the relevant locks before reading
 the AUTOINC value. If SUCCESS then the table AUTOINC mutex will be locked
-on return and all relevant locks acquired.
+on return (unless innodb_autoinc_lock_mode=2) and all relevant locks
+acquired.
 @return DB_SUCCESS or error code */
 
 dberr_t
@@ -16438,7 +16538,7 @@ ha_innobase::innobase_get_autoinc(
 		/* It should have been initialized during open. */
 		if (*value == 0) {
 			m_prebuilt->autoinc_error = DB_UNSUPPORTED;
-			m_prebuilt->table->autoinc_mutex.wr_unlock();
+			innobase_unlock_autoinc();
 		}
 	}
 
@@ -16498,6 +16598,14 @@ ha_innobase::get_auto_increment(
 	/* Prepare m_prebuilt->trx in the table handle */
 	update_thd(ha_thd());
 
+	/* In innodb_autoinc_lock_mode=2, the interval is reserved by a
+	compare-and-swap of dict_table_t::autoinc; if another thread
+	reserved values meanwhile, we must start over. */
+	const ulonglong	first_value_start = *first_value;
+	const ulint	n_autoinc_rows = m_prebuilt->trx->n_autoinc_rows;
+	const ulonglong	autoinc_last_value = m_prebuilt->autoinc_last_value;
+
+retry:
 	error = innobase_get_autoinc(&autoinc);
 
 	if (error != DB_SUCCESS) {
@@ -16505,6 +16613,8 @@ ha_innobase::get_auto_increment(
 		return;
 	}
 
+	uint64_t	autoinc_read = autoinc;
+
 	/* This is a hack, since nb_desired_values seems to be accurate only
 	for the first call to get_auto_increment() for multi-row INSERT and
 	meaningless for other statements e.g, LOAD etc. Subsequent calls to
@@ -16578,7 +16688,7 @@ ha_innobase::get_auto_increment(
 		/* Out of range number. Let handler::update_auto_increment()
 		take care of this */
 		m_prebuilt->autoinc_last_value = 0;
-		m_prebuilt->table->autoinc_mutex.wr_unlock();
+		innobase_unlock_autoinc();
 		*nb_reserved_values= 0;
 		return;
 	}
@@ -16602,11 +16712,20 @@ ha_innobase::get_auto_increment(
 
 		if (m_prebuilt->autoinc_last_value < *first_value) {
 			*first_value = (~(ulonglong) 0);
-		} else {
+		} else if (innobase_autoinc_lock_mode != AUTOINC_NO_LOCKING) {
 			/* Update the table autoinc variable */
 			dict_table_autoinc_update_if_greater(
 				m_prebuilt->table,
 				m_prebuilt->autoinc_last_value);
+		} else if (m_prebuilt->autoinc_last_value > autoinc_read
+			   && !m_prebuilt->table->autoinc
+			   .compare_exchange_strong(
+				   autoinc_read,
+				   m_prebuilt->autoinc_last_value)) {
+			*first_value = first_value_start;
+			trx->n_autoinc_rows = n_autoinc_rows;
+			m_prebuilt->autoinc_last_value = autoinc_last_value;
+			goto retry;
 		}
 	} else {
 		/* This will force write_row() into attempting an update
@@ -16621,7 +16740,7 @@ ha_innobase::get_auto_increment(
 	m_prebuilt->autoinc_offset = offset;
 	m_prebuilt->autoinc_increment = increment;
 
-	m_prebuilt->table->autoinc_mutex.wr_unlock();
+	innobase_unlock_autoinc();
 }
 
 /*******************************************************************//**
@@ -19293,6 +19412,13 @@ static MYSQL_SYSVAR_UINT(old_blocks_pct, innobase_old_blocks_pct,
   "Percentage of the buffer pool to reserve for 'old' blocks.",
   NULL, innodb_old_blocks_pct_update, 100 * 3 / 8, 5, 95, 0);
 
+static MYSQL_SYSVAR_ENUM(buffer_pool_lru_policy, buf_LRU_policy,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Replacement policy of the buffer pool: midpoint (use"
+  " innodb_old_blocks_time) or 2Q (make pages young only when they are"
+  " read again soon after being evicted from the old blocks)",
+  NULL, NULL, BUF_LRU_MIDPOINT, &innodb_buffer_pool_lru_policy_typelib);
+
 static MYSQL_SYSVAR_UINT(old_blocks_time, buf_LRU_old_threshold_ms,
   PLUGIN_VAR_RQCMDARG,
   "Move blocks to the 'new' end of the buffer pool if the first access"
@@ -19739,6 +19865,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(max_purge_lag_wait),
   MYSQL_SYSVAR(old_blocks_pct),
   MYSQL_SYSVAR(old_blocks_time),
+  MYSQL_SYSVAR(buffer_pool_lru_policy),
   MYSQL_SYSVAR(open_files),
   MYSQL_SYSVAR(optimize_fulltext_only),
   MYSQL_SYSVAR(rollback_on_timeout),
@@ -19766,6 +19893,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(sync_spin_loops),
   MYSQL_SYSVAR(spin_wait_delay),
   MYSQL_SYSVAR(table_locks),
+  MYSQL_SYSVAR(table_condition_pushdown),
   MYSQL_SYSVAR(prefix_index_cluster_optimization),
   MYSQL_SYSVAR(tmpdir),
   MYSQL_SYSVAR(autoinc_lock_mode),
@@ -20378,6 +20506,42 @@ bool ha_innobase::rowid_filter_push(Rowid_filter* pk_filter)
 	DBUG_RETURN(false);
 }
 
+/** Push down a table condition.
+@param[in]	cond	condition on this table
+@return cond; the SQL layer keeps evaluating all of it, while
+InnoDB may skip records that do not satisfy the simple
+comparisons in it */
+const COND* ha_innobase::cond_push(const COND* cond)
+{
+	DBUG_ENTER("ha_innobase::cond_push");
+	DBUG_ASSERT(cond != NULL);
+
+	/* Keep the condition that was pushed first. */
+	if (!m_table_cond) {
+		m_table_cond = make_engine_table_cond(
+			ha_thd(), cond, table, &m_table_cond_fields);
+	}
+
+	DBUG_RETURN(cond);
+}
+
+/** Check the table condition that was pushed down to a handler.
+@param h		row_prebuilt_t::table_cond
+@param mysql_rec	record in MySQL format, with the columns that
+			the condition refers to
+@return CHECK_ABORTED_BY_USER, CHECK_NEG, CHECK_POS, or CHECK_OUT_OF_RANGE
+@retval CHECK_POS if mysql_rec is not TABLE::record[0], which is where
+the condition reads the columns from */
+check_result_t innobase_table_cond_check(ha_innobase* h,
+					 const byte* mysql_rec)
+{
+	if (mysql_rec != h->table->record[0]) {
+		return(CHECK_POS);
+	}
+
+	return(handler_table_cond_check(h, h->m_table_cond));
+}
+
 static bool is_part_of_a_key_prefix(const Field_longstr *field)
 {
   const TABLE_SHARE *s= field->table->s;
@@ -422,6 +422,13 @@ class ha_innobase final : public handler
 	@retval	false if pushed (always) */
 	bool rowid_filter_push(Rowid_filter *rowid_filter) override;
 
+	/** Push down a table condition.
+	@param[in]	cond	condition on this table
+	@return cond; the SQL layer keeps evaluating all of it, while
+	InnoDB may skip records that do not satisfy the simple
+	comparisons in it */
+	const COND* cond_push(const COND* cond) override;
+
 	bool can_convert_nocopy(const Field &field,
 				const Column_definition& new_field) const
 		override;
@@ -451,6 +458,7 @@ class ha_innobase final : public handler
 
 	dberr_t innobase_get_autoinc(ulonglong* value);
 	dberr_t innobase_lock_autoinc();
+	inline void innobase_unlock_autoinc();
 	ulonglong innobase_peek_autoinc();
 	dberr_t innobase_set_max_autoinc(ulonglong auto_inc);
 
@@ -495,6 +503,13 @@ class ha_innobase final : public handler
 	/** Save CPU time with prebuilt/cached data structures */
 	row_prebuilt_t*		m_prebuilt;
 
+	/** The part of the pushed table condition that InnoDB evaluates
+	in row_search_mvcc(), or NULL; see cond_push() */
+	Item*			m_table_cond;
+
+	/** The columns that m_table_cond refers to */
+	MY_BITMAP		m_table_cond_fields;
+
 	/** Thread handle of the user currently using the handler;
 	this is set in external_lock function */
 	THD*			m_user_thd;
@@ -521,6 +536,9 @@ class ha_innobase final : public handler
 
         /** If mysql has locked with external_lock() */
         bool                    m_mysql_has_locked;
+
+	friend check_result_t innobase_table_cond_check(ha_innobase* h,
+							 const byte* mysql_rec);
 };
 
 
@@ -1187,6 +1187,9 @@ struct buf_pool_stat_t{
 				young because the first access
 				was not long enough ago, in
 				buf_page_peek_if_too_old() */
+	ulint	n_pages_read_young; /*!< number of pages read in to the
+				start of the LRU list, in
+				buf_pool_t::LRU_ghost_hit() */
 	/** number of waits for eviction; writes protected by buf_pool.mutex */
 	ulint	LRU_waits;
 	ulint	LRU_bytes;	/*!< LRU size in bytes */
@@ -1846,6 +1849,38 @@ class buf_pool_t
 					/*!< base node of the
 					unzip_LRU list */
 
+  /** Identifiers of pages that were evicted from the old blocks of the
+  LRU list, indexed by page_id_t::fold() % LRU_ghost_size, or ~0ULL;
+  nullptr unless innodb_buffer_pool_lru_policy=2Q. Protected by mutex. */
+  uint64_t *LRU_ghost;
+  /** number of elements in LRU_ghost */
+  ulint LRU_ghost_size;
+
+  /** Remember that a page was evicted from the old blocks of the LRU list.
+  @param id  page identifier */
+  void LRU_ghost_add(const page_id_t id)
+  {
+    mysql_mutex_assert_owner(&mutex);
+    if (LRU_ghost)
+      LRU_ghost[id.fold() % LRU_ghost_size]= id.raw();
+  }
+
+  /** Check if a page that is being read in was recently evicted from the
+  old blocks of the LRU list, and forget about the eviction.
+  @param id  page identifier
+  @return whether the page should be added to the start of the LRU list */
+  bool LRU_ghost_hit(const page_id_t id)
+  {
+    mysql_mutex_assert_owner(&mutex);
+    if (!LRU_ghost)
+      return false;
+    uint64_t &ghost= LRU_ghost[id.fold() % LRU_ghost_size];
+    if (ghost != id.raw())
+      return false;
+    ghost= ~0ULL;
+    stat.n_pages_read_young++;
+    return true;
+  }
 	/* @} */
   /** free ROW_FORMAT=COMPRESSED page frames */
   UT_LIST_BASE_NODE_T(buf_buddy_free_t) zip_free[BUF_BUDDY_SIZES_MAX];
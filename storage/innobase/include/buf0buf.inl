@@ -64,6 +64,21 @@ inline bool buf_page_peek_if_too_old(const buf_page_t *bpage)
 		statistics or move blocks in the LRU list.  This is
 		either the warm-up phase or an in-memory workload. */
 		return(FALSE);
+	} else if (bpage->old && buf_LRU_policy == BUF_LRU_2Q) {
+		/* Only a page that is read in again after having been
+		evicted from the old blocks will be added as young.
+		Count the same accesses as the midpoint policy below:
+		those that come too soon after the first access. */
+		if (buf_LRU_old_threshold_ms) {
+			uint32_t access_time = bpage->is_accessed();
+
+			if (!access_time
+			    || ((ib_uint32_t) (ut_time_ms() - access_time))
+			    < buf_LRU_old_threshold_ms) {
+				buf_pool.stat.n_pages_not_made_young++;
+			}
+		}
+		return false;
 	} else if (buf_LRU_old_threshold_ms && bpage->old) {
 		uint32_t access_time = bpage->is_accessed();
 
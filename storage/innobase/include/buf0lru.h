@@ -166,6 +166,21 @@ least this many milliseconds ago.  Not protected by any mutex or latch. */
 extern uint	buf_LRU_old_threshold_ms;
 /* @} */
 
+/** Buffer pool replacement policy (innodb_buffer_pool_lru_policy) */
+enum buf_LRU_policy_t
+{
+  /** Midpoint insertion; pages in the old blocks are made young
+  when accessed at least buf_LRU_old_threshold_ms after their first access */
+  BUF_LRU_MIDPOINT,
+  /** Pages in the old blocks are never made young on access. Instead,
+  a page that is read in again soon after it was evicted from the old
+  blocks is added to the start of the LRU list (buf_pool_t::LRU_ghost). */
+  BUF_LRU_2Q
+};
+
+/** innodb_buffer_pool_lru_policy; not protected by any mutex or latch */
+extern ulong	buf_LRU_policy;
+
 /** @brief Statistics for selecting the LRU list for eviction.
 
 These statistics are not 'of' LRU but 'for' LRU.  We keep count of I/O
@@ -101,6 +101,15 @@ which could result in a deadlock if the OS does not support asynchronous io.
 ulint
 buf_read_ahead_linear(const page_id_t page_id, ulint zip_size, bool ibuf);
 
+/** Issue asynchronous read requests for the next pages of an externally
+stored column. The pages of a BLOB are usually allocated at consecutive
+page numbers, but the successor of a BLOB page is only known after it has
+been read. NOTE: the calling thread may own latches on pages.
+@param page_id   the first page to read
+@param n_pages   number of consecutive pages to read
+@return number of page read requests issued */
+ulint buf_read_ahead_blob(const page_id_t page_id, ulint n_pages);
+
 /** Issue read requests for pages that need to be recovered.
 @param space_id	tablespace identifier
 @param page_nos	page numbers to read, in ascending order */
@@ -345,10 +345,12 @@ UNIV_INLINE
 bool
 dict_table_autoinc_update_if_greater(dict_table_t* table, ib_uint64_t value)
 {
-	if (value > table->autoinc) {
-
-		table->autoinc = value;
-		return(true);
+	/* In innodb_autoinc_lock_mode=2, other threads may be allocating
+	values without holding table->autoinc_mutex. */
+	for (uint64_t autoinc = table->autoinc; value > autoinc; ) {
+		if (table->autoinc.compare_exchange_strong(autoinc, value)) {
+			return(true);
+		}
 	}
 
 	return(false);
@@ -2355,8 +2355,10 @@ struct dict_table_t {
   Atomic_relaxed<pthread_t> lock_mutex_owner{0};
 #endif
 public:
-  /** Autoinc counter value to give to the next inserted row. */
-  uint64_t autoinc;
+  /** Autoinc counter value to give to the next inserted row.
+  Protected by autoinc_mutex, except that in innodb_autoinc_lock_mode=2
+  values are allocated by compare-and-swap without holding the mutex. */
+  Atomic_relaxed<uint64_t> autoinc;
 
   /** The transaction that currently holds the the AUTOINC lock on this table.
   Protected by lock_mutex.
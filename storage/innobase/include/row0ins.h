@@ -174,7 +174,8 @@ struct ins_node_t
 		row(NULL), table(table), select(NULL), values_list(NULL),
 		state(INS_NODE_SET_IX_LOCK), index(NULL),
 		entry_list(), entry(entry_list.end()),
-		trx_id(0), entry_sys_heap(mem_heap_create(128))
+		trx_id(0), entry_sys_heap(mem_heap_create(128)),
+		fk_cache_trx_id(0)
 	{
 	}
 	que_common_t common;	 /*!< node type: QUE_NODE_INSERT */
@@ -205,6 +206,22 @@ struct ins_node_t
 				entry_list and sys fields are stored here;
 				if this is NULL, entry list should be created
 				and buffers for sys fields in row allocated */
+	/** A referenced key that was found and S-locked while checking
+	a FOREIGN KEY constraint on insert */
+	struct fk_cache_t
+	{
+		/** the FOREIGN KEY constraint */
+		const dict_foreign_t*	foreign;
+		/** the referenced index where the key was found */
+		const dict_index_t*	index;
+		/** the lengths and contents of the foreign key fields */
+		std::vector<byte>	key;
+	};
+	/** transaction that holds the locks on the fk_cache keys */
+	trx_id_t	fk_cache_trx_id;
+	/** the most recently found referenced key of each constraint;
+	see row_ins_check_foreign_constraint() */
+	std::vector<fk_cache_t>	fk_cache;
         void vers_update_end(row_prebuilt_t *prebuilt, bool history_row);
 	bool vers_history_row() const; /* true if 'row' is historical */
 };
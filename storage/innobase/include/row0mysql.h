@@ -437,6 +437,8 @@ struct mysql_row_templ_t {
 					type and this field is != 0, then
 					it is an unsigned integer type */
 	ulint	is_virtual;		/*!< if a column is a virtual column */
+	bool	is_table_cond;		/*!< whether the column is needed
+					for evaluating table_cond */
 };
 
 #define MYSQL_FETCH_CACHE_SIZE		8
@@ -666,6 +668,11 @@ struct row_prebuilt_t {
 	ha_innobase*	idx_cond;
 	ulint		idx_cond_n_cols;/*!< Number of fields in idx_cond_cols.
 					0 if and only if idx_cond == NULL. */
+
+	/** Argument to innobase_table_cond_check(), or NULL if no
+	table condition is pushed down. Never set together with
+	idx_cond or pk_filter. */
+	ha_innobase*	table_cond;
 	/*----------------------*/
 
 	/*----------------------*/
@@ -710,6 +717,16 @@ struct SysIndexCallback {
 	virtual void operator()(mtr_t* mtr, btr_pcur_t* pcur) throw() = 0;
 };
 
+/** Check the table condition that was pushed down to a handler.
+@param h		row_prebuilt_t::table_cond
+@param mysql_rec	record in MySQL format, with the columns that
+			the condition refers to
+@return CHECK_ABORTED_BY_USER, CHECK_NEG, CHECK_POS, or CHECK_OUT_OF_RANGE
+@retval CHECK_POS if mysql_rec is not TABLE::record[0], which is where
+the condition reads the columns from */
+check_result_t innobase_table_cond_check(ha_innobase* h,
+					 const byte* mysql_rec);
+
 
 /** Storage for calculating virtual columns */
 
@@ -346,6 +346,8 @@ enum monitor_id_t {
 	/* Tablespace related counters */
 	MONITOR_MODULE_FIL_SYSTEM,
 	MONITOR_OVLD_N_FILE_OPENED,
+	MONITOR_FILE_OPENED,
+	MONITOR_FILE_CLOSED,
 
 	/* InnoDB Change Buffer related counters */
 	MONITOR_MODULE_IBUF_SYSTEM,
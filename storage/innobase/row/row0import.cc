@@ -57,7 +57,7 @@ using st_::span;
 /** The size of the buffer to use for IO.
 @param n physical page size
 @return number of pages */
-#define IO_BUFFER_SIZE(n)	((1024 * 1024) / (n))
+#define IO_BUFFER_SIZE(n)	((4 * 1024 * 1024) / (n))
 
 /** For gathering stats on records during phase I */
 struct row_stats_t {
@@ -3773,6 +3773,16 @@ static dberr_t fil_iterate(
 	bool		page_compressed = false;
 	bool		punch_hole = !my_test_if_thinly_provisioned(iter.file);
 
+#ifdef POSIX_FADV_SEQUENTIAL
+	/* The file will be read sequentially, each block exactly once.
+	The advice values are not flags; each needs a call of its own. */
+	posix_fadvise(iter.file.m_file, iter.start, 0,
+		      POSIX_FADV_SEQUENTIAL);
+# ifdef POSIX_FADV_NOREUSE
+	posix_fadvise(iter.file.m_file, iter.start, 0, POSIX_FADV_NOREUSE);
+# endif /* POSIX_FADV_NOREUSE */
+#endif /* POSIX_FADV_SEQUENTIAL */
+
 	for (offset = iter.start; offset < iter.end; offset += n_bytes) {
 		if (callback.is_interrupted()) {
 			err = DB_INTERRUPTED;
@@ -3812,6 +3822,15 @@ static dberr_t fil_iterate(
 			goto func_exit;
 		}
 
+#ifdef POSIX_FADV_WILLNEED
+		/* Let the next block be read while this one is converted
+		and written back. */
+		if (offset + n_bytes < iter.end) {
+			posix_fadvise(iter.file.m_file, offset + n_bytes,
+				      n_bytes, POSIX_FADV_WILLNEED);
+		}
+#endif /* POSIX_FADV_WILLNEED */
+
 		bool		updated = false;
 		os_offset_t	page_off = offset;
 		ulint		n_pages_read = n_bytes / size;
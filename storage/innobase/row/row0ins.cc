@@ -1448,6 +1448,90 @@ row_ins_set_exclusive_rec_lock(
 	return(err);
 }
 
+/** Serialize the foreign key fields of a referenced key.
+@param foreign  FOREIGN KEY constraint
+@param entry    referenced index entry
+@param key      the serialized key */
+static void row_ins_foreign_key_serialize(const dict_foreign_t *foreign,
+                                          const dtuple_t *entry,
+                                          std::vector<byte> *key)
+{
+  key->clear();
+  for (ulint i= 0; i < foreign->n_fields; i++)
+  {
+    const dfield_t *field= dtuple_get_nth_field(entry, i);
+    const ulint len= dfield_get_len(field);
+    const byte *data= static_cast<const byte*>(dfield_get_data(field));
+    key->insert(key->end(), reinterpret_cast<const byte*>(&len),
+                reinterpret_cast<const byte*>(&len + 1));
+    key->insert(key->end(), data, data + len);
+  }
+}
+
+/** Look up the cached referenced key of a FOREIGN KEY constraint.
+During a multi-row INSERT, consecutive rows often refer to the same
+parent row. Once that row has been found and S-locked by a transaction,
+it cannot be deleted or modified by other transactions until the lock
+is released at commit or rollback. As long as the transaction itself
+has not modified the referenced table, the key will still be found.
+@param thr      query thread
+@param foreign  FOREIGN KEY constraint
+@param index    referenced index
+@param entry    referenced index entry
+@return the cache entry for the constraint
+@retval nullptr if the cache is not applicable */
+static ins_node_t::fk_cache_t*
+row_ins_foreign_cache_get(que_thr_t *thr, const dict_foreign_t *foreign,
+                          const dict_index_t *index, const dtuple_t *entry)
+{
+  if (que_node_get_type(thr->run_node) != QUE_NODE_INSERT)
+    return nullptr;
+  trx_t *trx= thr_get_trx(thr);
+#ifdef WITH_WSREP
+  /* Galera needs to append the referenced key for each row. */
+  if (trx->is_wsrep())
+    return nullptr;
+#endif /* WITH_WSREP */
+  ins_node_t *node= static_cast<ins_node_t*>(thr->run_node);
+  if (node->fk_cache_trx_id != trx->id)
+  {
+    node->fk_cache.clear();
+    node->fk_cache_trx_id= trx->id;
+  }
+  if (trx->mod_tables.find(index->table) != trx->mod_tables.end())
+    return nullptr;
+  for (ins_node_t::fk_cache_t &c : node->fk_cache)
+    if (c.foreign == foreign)
+      return &c;
+  node->fk_cache.push_back(ins_node_t::fk_cache_t{foreign, nullptr, {}});
+  return &node->fk_cache.back();
+}
+
+/** Check whether a referenced key was found and locked by the transaction.
+@param cache    cache entry from row_ins_foreign_cache_get()
+@param index    referenced index
+@param entry    referenced index entry
+@return whether the key is known to exist */
+static bool row_ins_foreign_cache_hit(const ins_node_t::fk_cache_t &cache,
+                                      const dict_index_t *index,
+                                      const dtuple_t *entry)
+{
+  if (cache.index != index)
+    return false;
+  const byte *key= cache.key.data(), *const end= key + cache.key.size();
+  for (ulint i= 0; i < cache.foreign->n_fields; i++)
+  {
+    const dfield_t *field= dtuple_get_nth_field(entry, i);
+    const ulint len= dfield_get_len(field);
+    if (ulint(end - key) < sizeof len + len ||
+        memcmp(key, &len, sizeof len) ||
+        memcmp(key + sizeof len, dfield_get_data(field), len))
+      return false;
+    key+= sizeof len + len;
+  }
+  return key == end;
+}
+
 /***************************************************************//**
 Checks if foreign key constraint fails for an index entry. Sets shared locks
 which lock either the success or the failure of the constraint. NOTE that
@@ -1550,6 +1634,7 @@ row_ins_check_foreign_constraint(
 
 	dict_table_t *check_table;
 	dict_index_t *check_index;
+	ins_node_t::fk_cache_t *fk_cache;
 	dberr_t err = DB_SUCCESS;
 
 	{
@@ -1617,6 +1702,15 @@ row_ins_check_foreign_constraint(
 		goto exit_func;
 	}
 
+	if (!check_ref) {
+		fk_cache = nullptr;
+	} else if ((fk_cache = row_ins_foreign_cache_get(
+			    thr, foreign, check_index, entry))
+		   && row_ins_foreign_cache_hit(*fk_cache, check_index,
+						entry)) {
+		goto exit_func;
+	}
+
 	mtr_start(&mtr);
 
 	/* Store old value on n_fields_cmp */
@@ -1737,6 +1831,12 @@ row_ins_check_foreign_constraint(
 						        WSREP_SERVICE_KEY_REFERENCE);
 					}
 #endif /* WITH_WSREP */
+					if (fk_cache) {
+						fk_cache->index = check_index;
+						row_ins_foreign_key_serialize(
+							foreign, entry,
+							&fk_cache->key);
+					}
 					goto end_scan;
 				} else if (foreign->type != 0) {
 					/* There is an ON UPDATE or ON DELETE
@@ -3930,7 +3930,8 @@ row_sel_enqueue_cache_row_for_mysql(
 	/* For non ICP code path the row should already exist in the
 	next fetch cache slot. */
 
-	if (prebuilt->pk_filter || prebuilt->idx_cond) {
+	if (prebuilt->pk_filter || prebuilt->idx_cond
+	    || prebuilt->table_cond) {
 		memcpy(row_sel_fetch_last_buf(prebuilt), mysql_rec,
 		       prebuilt->mysql_row_len);
 	}
@@ -4139,6 +4140,78 @@ row_search_idx_cond_check(
 	return(result);
 }
 
+/** Check a pushed-down table condition and convert the record to
+MySQL format.
+@param[out]	mysql_rec	record in MySQL format
+@param[in,out]	prebuilt	prebuilt struct for the table handle
+@param[in]	rec		InnoDB record
+@param[in]	vrow		virtual columns
+@param[in]	rec_clust	whether index is the clustered index
+@param[in]	index		index of rec
+@param[in]	offsets		rec_get_offsets(rec)
+@param[in]	eval_cond	whether to evaluate the condition; false for
+exact lookups of a unique key (such as handler::rnd_pos()), whose callers
+expect the record to be found
+@return CHECK_ABORTED_BY_USER, CHECK_NEG, CHECK_POS, or CHECK_OUT_OF_RANGE */
+static
+check_result_t
+row_search_table_cond_check(
+	byte*			mysql_rec,
+	row_prebuilt_t*		prebuilt,
+	const rec_t*		rec,
+	const dtuple_t*		vrow,
+	bool			rec_clust,
+	const dict_index_t*	index,
+	const rec_offs*		offsets,
+	bool			eval_cond)
+{
+	ut_ad(prebuilt->table_cond);
+	ut_ad(!prebuilt->idx_cond);
+	ut_ad(!prebuilt->pk_filter);
+
+	if (eval_cond && prebuilt->select_lock_type == LOCK_NONE) {
+		/* Convert only the columns that the condition
+		refers to, so that a non-matching record can be
+		skipped without converting the rest of it. */
+		for (ulint i = 0; i < prebuilt->n_template; i++) {
+			const mysql_row_templ_t*templ
+				= &prebuilt->mysql_template[i];
+
+			if (!templ->is_table_cond) {
+				continue;
+			}
+
+			ut_ad(!templ->is_virtual);
+
+			if (!row_sel_store_mysql_field(
+				    mysql_rec, prebuilt, rec, index, offsets,
+				    rec_clust
+				    ? templ->clust_rec_field_no
+				    : templ->rec_field_no,
+				    templ)) {
+				return(CHECK_NEG);
+			}
+		}
+
+		check_result_t result = innobase_table_cond_check(
+			prebuilt->table_cond, mysql_rec);
+
+		if (result != CHECK_POS) {
+			return(result);
+		}
+	}
+
+	if (!row_sel_store_mysql_rec(mysql_rec, prebuilt, rec, vrow,
+				     rec_clust, index, offsets)) {
+		/* Only fresh inserts may contain incomplete
+		externally stored columns. Pretend that such
+		records do not exist. */
+		return(CHECK_NEG);
+	}
+
+	return(CHECK_POS);
+}
+
 /** Extract virtual column data from a virtual index record and fill a dtuple
 @param[in]	rec		the virtual (secondary) index record
 @param[in]	index		the virtual index
@@ -5597,6 +5670,26 @@ row_search_mvcc(
 				offsets));
 	ut_ad(!rec_get_deleted_flag(result_rec, comp));
 
+	if (prebuilt->table_cond) {
+		switch (row_search_table_cond_check(
+				buf, prebuilt, result_rec, vrow,
+				result_rec != rec,
+				result_rec != rec ? clust_index : index,
+				offsets, !unique_search)) {
+		case CHECK_NEG:
+			goto next_rec;
+		case CHECK_ABORTED_BY_USER:
+			err = DB_INTERRUPTED;
+			goto idx_cond_failed;
+		case CHECK_OUT_OF_RANGE:
+		case CHECK_ERROR:
+			err = DB_RECORD_NOT_FOUND;
+			goto idx_cond_failed;
+		case CHECK_POS:
+			break;
+		}
+	}
+
 	/* Decide whether to prefetch extra rows.
 	At this point, the clustered index record is protected
 	by a page latch that was acquired when pcur was positioned.
@@ -5623,7 +5716,8 @@ row_search_mvcc(
 		/* We only convert from InnoDB row format to MySQL row
 		format when ICP is disabled. */
 
-		if (!prebuilt->pk_filter && !prebuilt->idx_cond) {
+		if (!prebuilt->pk_filter && !prebuilt->idx_cond
+		    && !prebuilt->table_cond) {
 			/* We use next_buf to track the allocation of buffers
 			where we store and enqueue the buffers for our
 			pre-fetch optimisation.
@@ -5674,7 +5768,8 @@ row_search_mvcc(
 			goto next_rec;
 		}
 	} else {
-		if (!prebuilt->pk_filter && !prebuilt->idx_cond) {
+		if (!prebuilt->pk_filter && !prebuilt->idx_cond
+		    && !prebuilt->table_cond) {
 			/* The record was not yet converted to MySQL format. */
 			if (!row_sel_store_mysql_rec(
 				    buf, prebuilt, result_rec, vrow,
@@ -5898,7 +5993,8 @@ row_search_mvcc(
 
 	DEBUG_SYNC_C("row_search_for_mysql_before_return");
 
-	if (prebuilt->pk_filter || prebuilt->idx_cond) {
+	if (prebuilt->pk_filter || prebuilt->idx_cond
+	    || prebuilt->table_cond) {
 		/* When ICP is active we don't write to the MySQL buffer
 		directly, only to buffers that are enqueued in the pre-fetch
 		queue. We need to dequeue the first buffer and copy the contents
@@ -948,6 +948,16 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_EXISTING | MONITOR_DISPLAY_CURRENT | MONITOR_DEFAULT_ON),
 	 MONITOR_DEFAULT_START, MONITOR_OVLD_N_FILE_OPENED},
 
+	{"file_num_opened", "file_system",
+	 "Number of times a tablespace file was opened",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_FILE_OPENED},
+
+	{"file_num_closed", "file_system",
+	 "Number of tablespace files closed to adhere to innodb_open_files",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_FILE_CLOSED},
+
 	/* ========== Counters for Change Buffer ========== */
 	{"module_ibuf_system", "change_buffer", "InnoDB Change Buffer",
 	 MONITOR_MODULE,
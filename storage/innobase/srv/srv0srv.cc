@@ -962,6 +962,9 @@ srv_export_innodb_status(void)
 	export_vars.innodb_buffer_pool_pages_made_not_young
 		= buf_pool.stat.n_pages_not_made_young;
 
+	export_vars.innodb_buffer_pool_pages_read_young
+		= buf_pool.stat.n_pages_read_young;
+
 	export_vars.innodb_buffer_pool_pages_old = buf_pool.LRU_old_len;
 
 	export_vars.innodb_buffer_pool_bytes_dirty =
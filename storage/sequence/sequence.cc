@@ -137,6 +137,9 @@ int ha_seq::rnd_init(bool scan)
 
 int ha_seq::rnd_next(unsigned char *buf)
 {
+  /* Make the first calls expensive, like those that warm up caches */
+  DBUG_EXECUTE_IF("seq_slow_first_rnd_next",
+                  if (cur - seqs->from < 100) my_sleep(1000););
   if (seqs->reverse)
     return index_prev(buf);
   else
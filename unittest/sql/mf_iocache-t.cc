@@ -445,10 +445,44 @@ void mdev10963()
   my_delete(file_name, MYF(MY_WME));
 }
 
+/* Sequential read of a temporary file with read-ahead requested */
+void read_ahead()
+{
+  int res;
+  uchar buf[CACHE_SIZE * 5 + 100];
+  uchar buf_i[sizeof(buf)];
+  size_t total;
+
+  diag("read ahead");
+  init_io_cache_encryption();
+
+  for (size_t i= 0; i < sizeof(buf); i++)
+    buf[i]= (uchar) (i % 251);
+
+  res= open_cached_file(&info, 0, 0, CACHE_SIZE, 0);
+  ok(res == 0, "open_cached_file" INFO_TAIL);
+  res= my_b_write(&info, buf, sizeof(buf));
+  ok(res == 0, "write" INFO_TAIL);
+
+  res= reinit_io_cache(&info, READ_CACHE, 0, 1, 0);
+  ok(res == 0 && info.read_ahead, "reinit READ_CACHE with read ahead");
+
+  for (total= 0, res= 0; !res && total < sizeof(buf); total+= 700)
+    res= my_b_read(&info, buf_i + total, MY_MIN(700, sizeof(buf) - total));
+  ok(res == 0, "read in chunks" INFO_TAIL);
+  ok(memcmp(buf, buf_i, sizeof(buf)) == 0, "read correct data");
+  ok(my_b_read(&info, buf_i, 1) == 1, "eof");
+
+  res= reinit_io_cache(&info, WRITE_CACHE, 0, 0, 0);
+  ok(res == 0 && !info.read_ahead, "reinit WRITE_CACHE");
+
+  close_cached_file(&info);
+}
+
 int main(int argc __attribute__((unused)),char *argv[])
 {
   MY_INIT(argv[0]);
-  plan(277);
+  plan(284);
 
   /* temp files with and without encryption */
   encrypt_tmp_files= 1;
@@ -467,6 +501,7 @@ int main(int argc __attribute__((unused)),char *argv[])
   mdev14014();
   mdev17133();
   mdev10963();
+  read_ahead();
 
   my_end(0);
   return exit_status();